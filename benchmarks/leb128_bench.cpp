@@ -0,0 +1,89 @@
+// Decodes streams of LEB128 values with the word-at-a-time and the byte-at-a-time decoders. The value sizes follow
+// a few distributions: DIE attributes are mostly 1 or 2 byte values, addresses and hashes are long.
+//
+//     leb128_bench [values] [repetitions]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <cppdwarf/cppdwarf.hpp>
+
+namespace leb128 = cppdwarf::leb128;
+using clock_type = std::chrono::steady_clock;
+
+namespace {
+
+void encode(std::uint64_t value, std::vector<std::uint8_t> &out)
+{
+    do {
+        std::uint8_t byte = value & 0x7f;
+        value >>= 7;
+        if (value != 0) {
+            byte |= 0x80;
+        }
+        out.push_back(byte);
+    } while (value != 0);
+}
+
+// `count` values of up to `max_bits` significant bits, every bit count equally likely
+std::vector<std::uint8_t> make_stream(std::size_t count, unsigned max_bits, std::mt19937_64 &rng)
+{
+    std::vector<std::uint8_t> bytes;
+    for (std::size_t i = 0; i < count; ++i) {
+        const auto bits = std::uniform_int_distribution<unsigned>(1, max_bits)(rng);
+        encode(rng() >> (64 - bits), bytes);
+    }
+    return bytes;
+}
+
+template <typename Decode>
+double best_time(const std::vector<std::uint8_t> &bytes, int repetitions, Decode decode)
+{
+    double best = 0;
+    std::uint64_t sum = 0;
+    for (int i = 0; i < repetitions; ++i) {
+        const auto start = clock_type::now();
+        const auto *pos = bytes.data();
+        const auto *end = pos + bytes.size();
+        while (pos < end) {
+            const auto [value, length] = decode(pos, end);
+            sum += value;
+            pos += length;
+        }
+        const auto seconds = std::chrono::duration<double>(clock_type::now() - start).count();
+        best = i == 0 ? seconds : std::min(best, seconds);
+    }
+    if (sum == 42) {
+        std::cout << ""; // keeps the sums alive
+    }
+    return best;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    const auto count = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+    const int repetitions = argc > 2 ? std::max(1, std::atoi(argv[2])) : 5;
+    std::mt19937_64 rng(1);
+
+    struct distribution {
+        const char *name;
+        unsigned max_bits;
+    };
+    for (const auto &[name, max_bits] : {distribution{"1 byte", 7}, distribution{"1-2 bytes", 14},
+                                         distribution{"1-5 bytes", 32}, distribution{"1-10 bytes", 64}}) {
+        const auto bytes = make_stream(count, max_bits, rng);
+        const auto wordwise = best_time(bytes, repetitions, leb128::decode_unsigned);
+        const auto scalar = best_time(bytes, repetitions, leb128::decode_unsigned_scalar);
+        std::cout << name << ": " << static_cast<double>(count) / wordwise / 1e6 << " M values/s word-wise, "
+                  << static_cast<double>(count) / scalar / 1e6 << " M values/s byte-wise (x" << scalar / wordwise
+                  << ")\n";
+    }
+    return 0;
+}
@@ -0,0 +1,90 @@
+// Times full walks over every DIE and attribute of a binary, through libdwarf and through the native reader.
+//
+//     native_bench <binary> [repetitions]
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include <cppdwarf/cppdwarf.hpp>
+
+namespace dw = cppdwarf;
+using clock_type = std::chrono::steady_clock;
+
+namespace {
+
+// touches every attribute, so the readers cannot get away with decoding the DIE headers only
+template <typename Die>
+struct counting_visitor {
+    std::size_t dies = 0;
+    std::size_t attributes = 0;
+
+    void enter(const Die &die, const dw::walk_context & /*context*/)
+    {
+        ++dies;
+        for ([[maybe_unused]] const auto &attr : die.attributes()) {
+            ++attributes;
+        }
+    }
+};
+
+template <typename F>
+void run(const char *name, int repetitions, F &&walk_all)
+{
+    std::size_t dies = 0;
+    std::size_t attributes = 0;
+    double best = 0;
+    for (int i = 0; i < repetitions; ++i) {
+        const auto start = clock_type::now();
+        std::tie(dies, attributes) = walk_all();
+        const auto seconds = std::chrono::duration<double>(clock_type::now() - start).count();
+        best = i == 0 ? seconds : std::min(best, seconds);
+    }
+    std::cout << name << ": " << dies << " DIEs, " << attributes << " attributes, best of " << repetitions << " "
+              << best * 1000 << " ms, " << static_cast<double>(dies) / best / 1e6 << " M DIEs/s\n";
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2) {
+        std::cerr << "usage: " << argv[0] << " <binary> [repetitions]\n";
+        return 2;
+    }
+    const std::string path = argv[1];
+    const int repetitions = argc > 2 ? std::max(1, std::atoi(argv[2])) : 5;
+    try {
+        dw::debug debug(path);
+        run("libdwarf", repetitions, [&]() {
+            counting_visitor<dw::die> visitor;
+            dw::walker walker;
+            for (const auto &cu : debug) {
+                walker.walk(cu.die(), visitor);
+            }
+            return std::make_pair(visitor.dies, visitor.attributes);
+        });
+
+        const auto start = clock_type::now();
+        const dw::native::reader reader(debug);
+        std::cout << "native reader set up in "
+                  << std::chrono::duration<double, std::milli>(clock_type::now() - start).count() << " ms\n";
+        run("native", repetitions, [&]() {
+            counting_visitor<dw::native::die> visitor;
+            dw::native::walker walker;
+            for (const auto &unit : reader) {
+                walker.walk(unit.die(), visitor);
+            }
+            return std::make_pair(visitor.dies, visitor.attributes);
+        });
+    }
+    catch (const std::exception &err) {
+        std::cerr << path << ": " << err.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
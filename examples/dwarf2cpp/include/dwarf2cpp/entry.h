@@ -97,6 +97,7 @@ private:
     type_t return_type_;
     std::vector<std::unique_ptr<parameter_t>> parameters_;
     bool is_const_{false};
+    bool is_volatile_{false};
     bool is_member_{false};
     bool is_explicit_{false};
     dw::virtuality virtuality_{dw::virtuality::none};
@@ -215,3 +216,25 @@ private:
     std::map<std::size_t, std::vector<std::unique_ptr<entry>>> members_;
     std::optional<dw::access> access_;
 };
+
+// An entry restored from the incremental manifest, it only carries its rendered source.
+class cached_entry : public entry {
+public:
+    cached_entry(kind_t kind, std::string source, namespace_list namespaces)
+        : entry(std::move(namespaces)), kind_(kind), source_(std::move(source))
+    {
+    }
+    void parse(const dw::die &die, cu_parser &parser) override {}
+    [[nodiscard]] kind_t kind() const override
+    {
+        return kind_;
+    }
+    [[nodiscard]] std::string to_source() const override
+    {
+        return source_;
+    }
+
+private:
+    kind_t kind_;
+    std::string source_;
+};
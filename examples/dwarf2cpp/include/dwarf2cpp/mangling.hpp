@@ -0,0 +1,37 @@
+#pragma once
+
+#include <string_view>
+
+namespace mangling {
+
+struct cv_qualifiers {
+    bool is_const = false;
+    bool is_volatile = false;
+};
+
+// Read the cv-qualifiers of a member function straight from its Itanium mangled name, without building a demangle
+// tree. They are only encoded for nested names, right after the 'N':
+//   _Z N [r] [V] [K] [R | O] <prefix> <unqualified-name> E <bare-function-type>
+inline cv_qualifiers member_cv_qualifiers(std::string_view name)
+{
+    cv_qualifiers result;
+    constexpr std::string_view nested_prefix = "_ZN";
+    if (name.substr(0, nested_prefix.size()) != nested_prefix) {
+        return result;
+    }
+
+    auto pos = nested_prefix.size();
+    auto consume = [&](char c) {
+        if (pos < name.size() && name[pos] == c) {
+            ++pos;
+            return true;
+        }
+        return false;
+    };
+    consume('r'); // __restrict, not rendered
+    result.is_volatile = consume('V');
+    result.is_const = consume('K');
+    return result;
+}
+
+} // namespace mangling
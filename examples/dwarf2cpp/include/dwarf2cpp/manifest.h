@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <cppdwarf/cppdwarf.hpp>
+
+#include "dwarf2cpp/entry.h"
+#include "dwarf2cpp/path_table.hpp"
+
+namespace dw = cppdwarf;
+
+// Records, for every CU of a previous run, a fingerprint of its debug information together with the rendered entries it
+// contributed, so an incremental run only has to re-parse the CUs that changed.
+class manifest {
+public:
+    struct contribution {
+        std::string file;
+        std::size_t line;
+        std::size_t source; // index into the shared source pool
+    };
+
+    struct unit {
+        std::uint64_t fingerprint = 0;
+        std::vector<contribution> contributions;
+    };
+
+    struct cached_source {
+        entry::kind_t kind;
+        entry::namespace_list namespaces;
+        std::string source;
+    };
+
+    // returns an empty manifest if the file is missing or was written by an incompatible version
+    static manifest load(const std::filesystem::path &path);
+    void save(const std::filesystem::path &path) const;
+
+    // Hash of the CU's source files and every DIE in its tree, decoded through the native reader: tags, forms, strings,
+    // constants, flags and references within the CU. Addresses and offsets into other sections or CUs are left out, so
+    // a relink that only moves them leaves the fingerprint as it was.
+    static std::uint64_t fingerprint(const dw::native::unit &unit, const std::vector<path_table::id> &src_files,
+                                     const path_table &paths);
+
+    // for files the native reader cannot read: hash of the CU's source files and every DIE in its tree (tags,
+    // attributes and their values), read through libdwarf
+    static std::uint64_t fingerprint(const dw::compilation_unit &cu, const std::vector<path_table::id> &src_files,
+                                     const path_table &paths);
+
+    [[nodiscard]] const unit *find(const std::string &key) const;
+    unit &add(const std::string &key, std::uint64_t fingerprint);
+
+    [[nodiscard]] const std::unordered_map<std::string, unit> &units() const
+    {
+        return units_;
+    }
+
+    // deduplicates rendered entries, the same header entry is usually contributed by many CUs
+    std::size_t intern(cached_source source);
+
+    [[nodiscard]] const cached_source &source(std::size_t index) const
+    {
+        return sources_.at(index);
+    }
+
+private:
+    std::unordered_map<std::string, unit> units_;
+    std::vector<cached_source> sources_;
+    std::unordered_map<std::string, std::size_t> source_index_;
+};
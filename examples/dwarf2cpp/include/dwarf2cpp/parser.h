@@ -1,12 +1,16 @@
 #pragma once
 
+#include <memory>
+#include <optional>
+#include <unordered_set>
 #include <utility>
 
 #include <cppdwarf/cppdwarf.hpp>
 #include <spdlog/fmt/ostr.h>
 #include <spdlog/fmt/ranges.h>
 
-#include "dwarf2cpp/posixpath.hpp"
+#include "dwarf2cpp/manifest.h"
+#include "dwarf2cpp/path_table.hpp"
 #include "dwarf2cpp/source_file.h"
 
 namespace dw = cppdwarf;
@@ -18,24 +22,69 @@ class debug_parser {
 public:
     struct result {
         std::string base_dir;
-        std::unordered_map<std::string, source_file> files;
+        path_table paths;
+        std::unordered_map<path_table::id, source_file> files;
+        // in incremental mode, the files touched by a changed, new or removed CU; std::nullopt means all files
+        std::optional<std::unordered_set<path_table::id>> dirty_files;
+    };
+
+    struct stats_t {
+        std::size_t units = 0;
+        std::size_t restored_units = 0; // taken from the manifest in incremental mode
+        std::size_t visited_dies = 0;   // DIEs materialized by the cu_parser traversals
+        std::size_t entries = 0;
+        std::size_t peak_unit_state = 0; // the most memory the state of a cu_parser held, see cu_parser::memory_usage()
     };
 
     explicit debug_parser(dw::debug &dbg) : dbg_(dbg) {}
+    // incremental mode: CUs whose fingerprint matches the previous manifest are restored instead of parsed
+    debug_parser(dw::debug &dbg, manifest previous) : dbg_(dbg), previous_(std::move(previous))
+    {
+        result_.dirty_files.emplace();
+    }
+
+    // The CUs and DIEs parsed are reported to `monitor`, and parse() returns early, with a partial result, once it is
+    // cancelled. nullptr detaches the monitor.
+    void set_monitor(dw::scan_monitor *monitor)
+    {
+        monitor_ = monitor;
+    }
 
     const result &parse();
 
+    // the manifest describing this run, only filled in incremental mode
+    [[nodiscard]] const manifest &current_manifest() const
+    {
+        return current_;
+    }
+
+    [[nodiscard]] const stats_t &stats() const
+    {
+        return stats_;
+    }
+
 private:
     friend class cu_parser;
 
-    void add_entry(std::string file, std::size_t line, std::unique_ptr<entry> entry)
+    void add_entry(path_table::id file, std::size_t line, std::unique_ptr<entry> entry);
+    void restore_unit(const std::string &key, const manifest::unit &unit);
+    void mark_dirty(const manifest::unit &unit);
+    // returns false if the parse has been cancelled
+    bool dies_visited(std::size_t n) const
     {
-        file = posixpath::normpath(file);
-        result_.files[file].add(line, std::move(entry));
+        return !monitor_ || monitor_->dies_visited(n);
     }
 
+    std::uint64_t fingerprint(dw::compilation_unit &cu, const std::vector<path_table::id> &src_files);
+
     dw::debug &dbg_;
     result result_;
+    std::optional<manifest> previous_;
+    std::unique_ptr<dw::native::reader> native_; // reads the bytes of the CUs to fingerprint, if it can
+    manifest current_;
+    manifest::unit *current_unit_ = nullptr;
+    stats_t stats_;
+    dw::scan_monitor *monitor_ = nullptr;
 };
 
 class cu_parser {
@@ -45,19 +94,77 @@ public:
     cu_parser(dw::compilation_unit &cu, debug_parser &dbg_parser);
     void parse();
 
+    [[nodiscard]] std::size_t visited_dies() const
+    {
+        return visited_dies_;
+    }
+
+    // true if the parse stopped early, leaving the CU's entries out
+    [[nodiscard]] bool cancelled() const
+    {
+        return cancelled_;
+    }
+
+    // An estimate of the memory the parser's state holds: the known types, pending templates and candidates, without
+    // what the dies of pending templates hold in libdwarf. The candidates are cleared once parsed but keep their
+    // capacity, so after parse() this is about the peak.
+    [[nodiscard]] std::size_t memory_usage() const;
+
+    // ids of the CU's line table files in debug_parser::result::paths, path_table::npos for unnamed files
+    [[nodiscard]] const std::vector<path_table::id> &src_files() const
+    {
+        return src_files_;
+    }
+
     [[nodiscard]] type_t get_type(const dw::die &die);
 
+    // The DW_AT_name of a class, struct, union or enum for its declaration, empty if it has none. The template
+    // arguments of a specialization are rebuilt from its template parameter DIEs like those of the type names, see
+    // get_type(); `namespaces` are those the entity is declared in.
+    [[nodiscard]] std::string declared_name(const dw::die &die, const namespace_list &namespaces);
+
 private:
-    void parse_types(const dw::die &die, namespace_list &parents);
+    // a template specialization whose name is rebuilt from its template parameter DIEs on first use
+    struct template_t {
+        struct parameter {
+            dw::die type;
+            std::optional<std::uint64_t> value; // set for template value parameters
+            bool is_unsigned = false;            // the value's type is unsigned, otherwise it is two's complement
+        };
+        std::string qualified_name; // without the template arguments
+        std::vector<parameter> parameters;
+    };
+
+    // an entry found during the traversal, parsed once all named types of the CU are known
+    struct candidate {
+        std::size_t offset;
+        path_table::id file;
+        std::size_t line;
+        std::unique_ptr<entry> entry;
+    };
+
+    struct collect_visitor;
+
+    // records named types and collects entry candidates, see collect_visitor
+    void collect();
+    void add_candidate(const dw::die &die, dw::tag tag, const std::string &name, const namespace_list &namespaces);
+    static std::optional<std::vector<template_t::parameter>> get_template_parameters(const dw::die &die);
+    // unsigned, boolean and character base types and enumerations based on them, through typedefs and cv-qualifiers
+    static bool is_unsigned_type(const dw::die &type);
+    std::string resolve_template(const template_t &tmpl);
+    // inline namespaces of the standard libraries (libc++'s std::__1, libstdc++'s std::__cxx11) are skipped
+    static bool is_inline_namespace(const namespace_list &parents, const std::string &name)
+    {
+        return parents.size() == 1 && parents.at(0) == "std" && (name == "__1" || name == "__cxx11");
+    }
 
-    void parse_children(const dw::die &die, namespace_list &namespaces);
     void parse_namespace(const dw::die &die, namespace_list &namespaces);
     // parse a non-member type, for member types, see parse_member_type
     void parse_type(const dw::die &die, const namespace_list &namespaces);
     // parse a non-member function, for member functions, see parse_member_function
     void parse_function(const dw::die &die, const namespace_list &namespaces);
 
-    void add_entry(std::string file, std::size_t line, std::unique_ptr<entry> entry) const;
+    void add_entry(path_table::id file, std::size_t line, std::unique_ptr<entry> entry) const;
     static std::string get_qualified_name(const namespace_list &namespaces, const std::string &name)
     {
         std::string qualified_name;
@@ -79,7 +186,11 @@ private:
 
 private:
     dw::compilation_unit &cu_;
-    std::vector<std::string> src_files_;
+    std::vector<path_table::id> src_files_;
     std::unordered_map<std::size_t, type_t> known_types_{};
+    std::unordered_map<std::size_t, template_t> pending_templates_{};
+    std::vector<candidate> candidates_;
+    std::size_t visited_dies_ = 0;
+    bool cancelled_ = false; // set when a check every scan_monitor::die_interval DIEs finds the parse cancelled
     debug_parser &dbg_parser_;
 };
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "dwarf2cpp/posixpath.hpp"
+
+// Interns normalized file paths, so the entry pipeline can refer to files by a small integer id. The same few
+// thousand headers show up in every CU, each distinct raw path is only normalized once.
+class path_table {
+public:
+    using id = std::uint32_t;
+    static constexpr id npos = std::numeric_limits<id>::max();
+
+    path_table() = default;
+    path_table(const path_table &) = delete;
+    path_table &operator=(const path_table &) = delete;
+    path_table(path_table &&) = default;
+    path_table &operator=(path_table &&) = default;
+
+    // id of an already normalized path
+    id intern(std::string_view path)
+    {
+        if (auto it = ids_.find(path); it != ids_.end()) {
+            return it->second;
+        }
+        auto new_id = static_cast<id>(paths_.size());
+        const auto &stored = paths_.emplace_back(path);
+        ids_.emplace(stored, new_id);
+        return new_id;
+    }
+
+    // id of a path as written in the line table, e.g. "/src/foo/../include/bar.h"
+    id intern_raw(std::string_view raw_path)
+    {
+        if (auto it = raw_ids_.find(raw_path); it != raw_ids_.end()) {
+            return it->second;
+        }
+        auto new_id = intern(posixpath::normpath(raw_path));
+        raw_ids_.emplace(raw_paths_.emplace_back(raw_path), new_id);
+        return new_id;
+    }
+
+    [[nodiscard]] const std::string &operator[](id path_id) const
+    {
+        return paths_.at(path_id);
+    }
+
+    [[nodiscard]] std::size_t size() const
+    {
+        return paths_.size();
+    }
+
+private:
+    // std::deque never moves its elements, so the string_view keys stay valid
+    std::deque<std::string> paths_;
+    std::unordered_map<std::string_view, id> ids_;
+    std::deque<std::string> raw_paths_;
+    std::unordered_map<std::string_view, id> raw_ids_;
+};
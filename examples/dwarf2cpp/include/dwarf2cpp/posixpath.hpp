@@ -1,39 +1,64 @@
 #pragma once
 
 #include <algorithm>
-#include <iostream>
-#include <iterator>
-#include <sstream>
 #include <string>
+#include <string_view>
 #include <vector>
 
 namespace posixpath {
 
 static constexpr char sep = '/';
 
+// Iterates over the components of a path without copying them. Like splitting with std::getline, a leading
+// separator yields an empty first component and a trailing separator does not yield an empty last one.
+class components {
+public:
+    explicit components(std::string_view path) : rest_(path) {}
+
+    // stores the next component in `component`, returns false once the path is exhausted
+    bool next(std::string_view &component)
+    {
+        if (rest_.empty()) {
+            return false;
+        }
+        auto pos = rest_.find(sep);
+        if (pos == std::string_view::npos) {
+            component = rest_;
+            rest_ = {};
+        }
+        else {
+            component = rest_.substr(0, pos);
+            rest_.remove_prefix(pos + 1);
+        }
+        return true;
+    }
+
+private:
+    std::string_view rest_;
+};
+
 // Function to split a path into components
-inline std::vector<std::string> split(const std::string &path)
+inline std::vector<std::string> split(std::string_view path)
 {
-    std::vector<std::string> components;
-    std::istringstream stream(path);
-    std::string segment;
-    while (std::getline(stream, segment, sep)) {
-        components.push_back(segment);
+    std::vector<std::string> result;
+    components it(path);
+    for (std::string_view component; it.next(component);) {
+        result.emplace_back(component);
     }
-    return components;
+    return result;
 }
 
 // Function to join components into a path using variadic parameters
 inline std::string join(const std::vector<std::string> &paths)
 {
-    std::ostringstream joined;
+    std::string joined;
     for (size_t i = 0; i < paths.size(); ++i) {
         if (i > 0) {
-            joined << '/'; // Add a separator between components
+            joined += sep; // Add a separator between components
         }
-        joined << paths[i];
+        joined += paths[i];
     }
-    return joined.str();
+    return joined;
 }
 
 // Variadic join function
@@ -44,6 +69,19 @@ std::string join(Args... paths)
     return join(components);
 }
 
+// Common path of two paths, returned as a prefix of `a` so nothing is allocated
+inline std::string_view commonpath(std::string_view a, std::string_view b)
+{
+    components lhs(a);
+    components rhs(b);
+    std::size_t length = 0;
+    std::string_view x, y;
+    while (lhs.next(x) && rhs.next(y) && x == y) {
+        length = static_cast<std::size_t>(x.data() - a.data()) + x.size();
+    }
+    return a.substr(0, length);
+}
+
 // Function to find the common path
 inline std::string commonpath(const std::vector<std::string> &paths)
 {
@@ -51,88 +89,90 @@ inline std::string commonpath(const std::vector<std::string> &paths)
         return "";
     }
 
-    // Split all paths into components
-    std::vector<std::vector<std::string>> split_paths;
-    split_paths.reserve(paths.size());
-    for (const auto &path : paths) {
-        split_paths.push_back(split(path));
+    std::string_view common = paths[0];
+    for (size_t i = 1; i < paths.size(); ++i) {
+        common = commonpath(common, paths[i]);
     }
-
-    // Find the common prefix of all split paths
-    std::vector<std::string> common;
-    for (size_t i = 0; i < split_paths[0].size(); ++i) {
-        std::string current = split_paths[0][i];
-        for (size_t j = 1; j < split_paths.size(); ++j) {
-            if (i >= split_paths[j].size() || split_paths[j][i] != current) {
-                return join(common);
-            }
-        }
-        common.push_back(current);
-    }
-
-    return join(common);
+    return std::string(common);
 }
 
 // Normalize path by removing redundant ".." and "." components
-inline std::string normpath(const std::string &path)
+inline std::string normpath(std::string_view path)
 {
-    std::vector<std::string> components = split(path);
-    std::vector<std::string> normalized;
-
-    for (const auto &component : components) {
+    std::string normalized;
+    normalized.reserve(path.size());
+    std::size_t count = 0;
+
+    auto last = [&]() {
+        auto pos = normalized.rfind(sep);
+        return pos == std::string::npos ? std::string_view(normalized) : std::string_view(normalized).substr(pos + 1);
+    };
+    auto push = [&](std::string_view component) {
+        if (count++ > 0) {
+            normalized += sep;
+        }
+        normalized += component;
+    };
+    auto pop = [&]() {
+        auto pos = normalized.rfind(sep);
+        normalized.erase(--count == 0 || pos == std::string::npos ? 0 : pos);
+    };
+
+    components it(path);
+    for (std::string_view component; it.next(component);) {
         if (component == "..") {
-            if (!normalized.empty() && normalized.back() != "..") {
-                normalized.pop_back(); // Go up one directory
+            if (count > 0 && last() != "..") {
+                pop(); // Go up one directory
             }
             else {
-                normalized.push_back(component); // Keep ".." if no parent to go up to
+                push(component); // Keep ".." if no parent to go up to
             }
         }
         else if (component != ".") {
-            normalized.push_back(component);
+            push(component);
         }
     }
-
-    return join(normalized);
+    return normalized;
 }
 
 // Compute the relative path
-inline std::string relpath(const std::string &path, const std::string &start = "/")
+inline std::string relpath(std::string_view path, std::string_view start = "/")
 {
     // Normalize the paths
-    std::string norm_path = normpath(path);
-    std::string norm_start = normpath(start);
-
-    // Split the normalized paths into components
-    std::vector<std::string> path_components = split(norm_path);
-    std::vector<std::string> start_components = split(norm_start);
-
-    // Find the common prefix
-    size_t common_length = 0;
-    for (size_t i = 0; i < std::min(path_components.size(), start_components.size()); ++i) {
-        if (path_components[i] == start_components[i]) {
-            ++common_length;
-        }
-        else {
-            break;
-        }
+    const std::string norm_path = normpath(path);
+    const std::string norm_start = normpath(start);
+
+    // Skip the common prefix
+    components path_it(norm_path);
+    components start_it(norm_start);
+    std::string_view path_component, start_component;
+    bool has_path = path_it.next(path_component);
+    bool has_start = start_it.next(start_component);
+    while (has_path && has_start && path_component == start_component) {
+        has_path = path_it.next(path_component);
+        has_start = start_it.next(start_component);
     }
 
-    // Compute the relative path
-    std::vector<std::string> relative_components;
+    std::string relative;
+    std::size_t count = 0;
+    auto append = [&](std::string_view component) {
+        if (count++ > 0) {
+            relative += sep;
+        }
+        relative += component;
+    };
 
     // Add ".." for each remaining component in the start path
-    for (size_t i = common_length; i < start_components.size(); ++i) {
-        relative_components.emplace_back("..");
+    for (; has_start; has_start = start_it.next(start_component)) {
+        append("..");
     }
 
     // Add the remaining components of the target path
-    for (size_t i = common_length; i < path_components.size(); ++i) {
-        relative_components.push_back(path_components[i]);
+    for (; has_path; has_path = path_it.next(path_component)) {
+        append(path_component);
     }
 
-    // Join the components into the final relative path
-    return relative_components.empty() ? "." : join(relative_components);
+    return count == 0 ? "." : relative;
 }
 
 } // namespace posixpath
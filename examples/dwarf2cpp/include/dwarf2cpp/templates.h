@@ -0,0 +1,9 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+// Builds the name of a template specialization from its qualified name (without arguments) and its rendered
+// template arguments. Trailing arguments that are the standard library defaults (allocators, hashers, comparators,
+// char traits, deleters, ...) are dropped and well-known aliases such as std::string are used where possible.
+std::string format_template(const std::string &name, std::vector<std::string> args);
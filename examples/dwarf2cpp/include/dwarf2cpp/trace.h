@@ -0,0 +1,70 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <utility>
+
+// Timeline of a run in the Chrome trace-event format, viewable in chrome://tracing or https://ui.perfetto.dev.
+// Tracing is off until trace::start() is called, a span then costs a clock read and a push into a buffer owned
+// by the current thread; no lock is taken after a thread's first span. The buffers are written out once by
+// trace::finish(), when all threads that recorded spans are done.
+namespace trace {
+
+using clock = std::chrono::steady_clock;
+
+namespace details {
+inline std::atomic<bool> enabled{false};
+
+void record(const char *name, std::string arg, clock::time_point start, clock::time_point end);
+} // namespace details
+
+void start();
+// writes every span recorded so far to `path` and turns tracing off
+void finish(const std::filesystem::path &path);
+// names the current thread in the trace viewer
+void name_thread(std::string name);
+
+[[nodiscard]] inline bool enabled()
+{
+    return details::enabled.load(std::memory_order_relaxed);
+}
+
+// Records the time from its construction to its destruction as a span on the current thread, e.g.
+//     trace::span span("parse CU", name);
+// `name` must be a string literal, `arg` is shown with the span in the viewer.
+class span {
+public:
+    explicit span(const char *name) : name_(name)
+    {
+        if (enabled()) {
+            start_ = clock::now();
+        }
+    }
+
+    span(const char *name, std::string arg) : name_(name)
+    {
+        if (enabled()) {
+            arg_ = std::move(arg);
+            start_ = clock::now();
+        }
+    }
+
+    ~span()
+    {
+        if (start_ != clock::time_point{}) {
+            details::record(name_, std::move(arg_), start_, clock::now());
+        }
+    }
+
+    span(const span &) = delete;
+    span &operator=(const span &) = delete;
+
+private:
+    const char *name_;
+    std::string arg_;
+    clock::time_point start_{};
+};
+
+} // namespace trace
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+
+#include "dwarf2cpp/parser.h"
+
+class file_writer {
+public:
+    struct stats {
+        std::size_t written = 0;
+        std::size_t unchanged = 0;
+        std::size_t skipped = 0; // not rendered at all, see debug_parser::result::dirty_files
+        std::size_t removed = 0; // dirty files no CU contributes to any more
+        std::size_t bytes = 0;
+        std::chrono::duration<double> elapsed{};
+    };
+
+    // jobs == 0 uses one thread per hardware core
+    explicit file_writer(std::filesystem::path output_dir, unsigned jobs = 0);
+
+    // render and write every (dirty) file under result.base_dir, spread over the worker threads, and remove the
+    // outputs of dirty files left without content
+    stats write(const debug_parser::result &result);
+
+private:
+    // returns false if the file on disk already has the same content
+    bool write_file(const std::filesystem::path &path, const std::string &content);
+    void create_directories(const std::filesystem::path &dir);
+
+    std::filesystem::path output_dir_;
+    unsigned jobs_;
+    std::mutex dirs_mutex_;
+    std::unordered_set<std::string> created_dirs_;
+};
@@ -2,11 +2,11 @@
 
 #include <sstream>
 
-#include <llvm/Demangle/Demangle.h>
 #include <spdlog/fmt/ostr.h>
 #include <spdlog/spdlog.h>
 
 #include "dwarf2cpp/algorithm.hpp"
+#include "dwarf2cpp/mangling.hpp"
 #include "dwarf2cpp/parser.h"
 
 namespace {
@@ -46,15 +46,16 @@ std::string type_t::describe(const std::string &name) const
 
 void parameter_t::parse(const dw::die &die, cu_parser &parser)
 {
-    if (die.attributes().contains(dw::attribute_t::name)) {
-        name_ = die.attributes().at(dw::attribute_t::name)->get<std::string>();
+    const auto [name, artificial] = die.read<dw::attribute_t::name, dw::attribute_t::artificial>();
+    if (name) {
+        name_ = *name;
     }
     if (die.attributes().contains(dw::attribute_t::type)) {
         const auto type = die.attributes().at(dw::attribute_t::type)->get<dw::die>();
         type_ = parser.get_type(type);
     }
-    if (die.attributes().contains(dw::attribute_t::artificial)) {
-        is_artificial_ = die.attributes().at(dw::attribute_t::artificial)->get<bool>();
+    if (artificial) {
+        is_artificial_ = *artificial;
     }
 }
 
@@ -65,29 +66,31 @@ std::string parameter_t::to_source() const
 
 void function_t::parse(const dw::die &die, cu_parser &parser)
 {
-    name_ = die.attributes().at(dw::attribute_t::name)->get<std::string>();
-    if (die.attributes().contains(dw::attribute_t::linkage_name)) {
-        linkage_name_ = die.attributes().at(dw::attribute_t::linkage_name)->get<std::string>();
-        if (const char *demangled = llvm::itaniumDemangle(linkage_name_, true)) {
-            std::string demangled_name = demangled;
-            static const std::string const_str = "const";
-            if (demangled_name.size() >= const_str.size()) {
-                is_const_ = std::equal(const_str.rbegin(), const_str.rend(), demangled_name.rbegin());
-            }
-        }
+    const auto [name, linkage_name, is_explicit, virtuality, accessibility] =
+        die.read<dw::attribute_t::name, dw::attribute_t::linkage_name, dw::attribute_t::explicit_,
+                 dw::attribute_t::virtuality, dw::attribute_t::accessibility>();
+    if (!name) {
+        throw std::runtime_error("function without a name");
+    }
+    name_ = *name;
+    if (linkage_name) {
+        linkage_name_ = *linkage_name;
+        const auto qualifiers = mangling::member_cv_qualifiers(linkage_name_);
+        is_const_ = qualifiers.is_const;
+        is_volatile_ = qualifiers.is_volatile;
     }
     if (die.attributes().contains(dw::attribute_t::type)) {
         const auto return_type = die.attributes().at(dw::attribute_t::type)->get<dw::die>();
         return_type_ = parser.get_type(return_type);
     }
-    if (die.attributes().contains(dw::attribute_t::explicit_)) {
-        is_explicit_ = die.attributes().at(dw::attribute_t::explicit_)->get<bool>();
+    if (is_explicit) {
+        is_explicit_ = *is_explicit;
     }
-    if (die.attributes().contains(dw::attribute_t::virtuality)) {
-        virtuality_ = static_cast<dw::virtuality>(die.attributes().at(dw::attribute_t::virtuality)->get<int>());
+    if (virtuality) {
+        virtuality_ = *virtuality;
     }
-    if (die.attributes().contains(dw::attribute_t::accessibility)) {
-        access_ = static_cast<dw::access>(die.attributes().at(dw::attribute_t::accessibility)->get<int>());
+    if (accessibility) {
+        access_ = *accessibility;
     }
 
     int param_index = 0;
@@ -142,6 +145,9 @@ std::string function_t::to_source() const
     if (is_const_) {
         ss << " const";
     }
+    if (is_volatile_) {
+        ss << " volatile";
+    }
     if (virtuality_ == dw::virtuality::pure_virtual) {
         ss << " = 0";
     }
@@ -186,14 +192,16 @@ void field_t::parse(const dw::die &die, cu_parser &parser)
             }
         }
     }
-    if (die.attributes().contains(dw::attribute_t::data_member_location)) {
-        member_location_ = die.attributes().at(dw::attribute_t::data_member_location)->get<std::size_t>();
+    const auto [location, accessibility, external] =
+        die.read<dw::attribute_t::data_member_location, dw::attribute_t::accessibility, dw::attribute_t::external>();
+    if (location) {
+        member_location_ = static_cast<std::size_t>(*location);
     }
-    if (die.attributes().contains(dw::attribute_t::accessibility)) {
-        access_ = static_cast<dw::access>(die.attributes().at(dw::attribute_t::accessibility)->get<int>());
+    if (accessibility) {
+        access_ = *accessibility;
     }
-    if (die.attributes().contains(dw::attribute_t::external)) {
-        is_static = die.attributes().at(dw::attribute_t::external)->get<bool>();
+    if (external) {
+        is_static = *external;
     }
     if (die.attributes().contains(dw::attribute_t::const_value)) {
         default_value_ = die.attributes().at(dw::attribute_t::const_value)->get<std::int64_t>();
@@ -314,9 +322,7 @@ std::string typedef_t::to_source() const
 
 void enum_t::parse(const dw::die &die, cu_parser &parser)
 {
-    if (die.attributes().contains(dw::attribute_t::name)) {
-        name_ = die.attributes().at(dw::attribute_t::name)->get<std::string>();
-    }
+    name_ = parser.declared_name(die, namespaces());
     if (die.attributes().contains(dw::attribute_t::type)) {
         base_type_ = parser.get_type(die.attributes().at(dw::attribute_t::type)->get<dw::die>());
     }
@@ -354,9 +360,7 @@ std::string enum_t::to_source() const
 
 void struct_t::parse(const dw::die &die, cu_parser &parser)
 {
-    if (die.attributes().contains(dw::attribute_t::name)) {
-        name_ = die.attributes().at(dw::attribute_t::name)->get<std::string>();
-    }
+    name_ = parser.declared_name(die, namespaces());
     if (die.attributes().contains(dw::attribute_t::byte_size)) {
         byte_size = die.attributes().at(dw::attribute_t::byte_size)->get<std::size_t>();
     }
@@ -463,9 +467,7 @@ std::string struct_t::to_source() const
 
 void union_t::parse(const dw::die &die, cu_parser &parser)
 {
-    if (die.attributes().contains(dw::attribute_t::name)) {
-        name_ = die.attributes().at(dw::attribute_t::name)->get<std::string>();
-    }
+    name_ = parser.declared_name(die, namespaces());
     if (die.attributes().contains(dw::attribute_t::accessibility)) {
         access_ = static_cast<dw::access>(die.attributes().at(dw::attribute_t::accessibility)->get<int>());
     }
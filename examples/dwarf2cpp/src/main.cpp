@@ -1,23 +1,92 @@
+#include <chrono>
+#include <csignal>
 #include <filesystem>
-#include <unordered_set>
+#include <iostream>
 
 #include <argparse/argparse.hpp>
 #include <cppdwarf/cppdwarf.hpp>
-#include <spdlog/fmt/std.h>
 #include <spdlog/spdlog.h>
 
 #include "dwarf2cpp/parser.h"
-#include "dwarf2cpp/posixpath.hpp"
+#include "dwarf2cpp/trace.h"
+#include "dwarf2cpp/writer.h"
 
 namespace dw = cppdwarf;
 namespace fs = std::filesystem;
 
-using file_entry_storage = std::unordered_map<std::string, std::unordered_set<std::string>>;
+// cancelled by the first SIGINT, which stops the parse between DIEs; a second one terminates as usual
+dw::cancellation_token interrupted;
+
+void on_interrupt(int /*signal*/)
+{
+    interrupted.cancel();
+    std::signal(SIGINT, SIG_DFL);
+}
+
+void log_progress(const dw::scan_progress &progress)
+{
+    constexpr double mib = 1024.0 * 1024.0;
+    spdlog::info("progress: {:5.1f}% ({}/{} CUs, {:.1f}/{:.1f} MiB, {} DIEs)", progress.fraction() * 100,
+                 progress.units_done, progress.units_total, static_cast<double>(progress.bytes_done) / mib,
+                 static_cast<double>(progress.bytes_total) / mib, progress.dies);
+}
+
+void log_perf_stats(const dw::perf_stats &stats)
+{
+    if (!stats.enabled) {
+        spdlog::info("cppdwarf performance counters are not available, build with -DCPPDWARF_STATS=ON");
+        return;
+    }
+    spdlog::info("cppdwarf: {} DIEs, {} attribute lists, {} references resolved, {} strings copied", stats.dies,
+                 stats.attribute_lists, stats.reference_resolutions, stats.string_copies);
+    for (std::size_t i = 0; i < dw::libdwarf_call_count; ++i) {
+        const auto call = static_cast<dw::libdwarf_call>(i);
+        if (stats.call_count(call) == 0) {
+            continue;
+        }
+        if (dw::is_timed(call)) {
+            spdlog::info("  {:<24} {:>10} calls {:>10.2f} ms", dw::to_string(call), stats.call_count(call),
+                         std::chrono::duration<double, std::milli>(stats.time_in(call)).count());
+        }
+        else {
+            spdlog::info("  {:<24} {:>10} calls", dw::to_string(call), stats.call_count(call));
+        }
+    }
+}
+
+void log_memory(const dw::memory_usage &memory, const dw::heap_usage &heap)
+{
+    constexpr double mib = 1024.0 * 1024.0;
+    spdlog::info("memory: {:.1f} MiB preloaded sections, {:.1f} MiB libdwarf sections (estimated), "
+                 "{:.1f} MiB unit table",
+                 static_cast<double>(memory.preloaded_sections) / mib,
+                 static_cast<double>(memory.libdwarf_sections) / mib, static_cast<double>(memory.unit_table) / mib);
+    if (!heap.enabled) {
+        return;
+    }
+    for (std::size_t i = 0; i < dw::memory_category_count; ++i) {
+        spdlog::info("  {:<16} {:>12} bytes held {:>12} at peak {:>10} allocations",
+                     dw::to_string(static_cast<dw::memory_category>(i)), heap.bytes[i], heap.peak_bytes[i],
+                     heap.allocations[i]);
+    }
+}
 
 int main(int argc, char *argv[])
 {
     argparse::ArgumentParser parser("cpp2dwarf");
     parser.add_argument("path").help("path to a DWARF debug symbol file");
+    parser.add_argument("-j", "--jobs")
+        .help("number of threads used to write output files (0: one per core)")
+        .default_value(0)
+        .scan<'i', int>();
+    parser.add_argument("--manifest")
+        .help("incremental mode: only re-parse CUs that changed since the run that wrote this manifest");
+    parser.add_argument("--preload")
+        .help("load and decompress all debug sections up front on a thread pool instead of through libdwarf")
+        .flag();
+    parser.add_argument("--trace").help("write a Chrome trace-event timeline of the run to this JSON file");
+    parser.add_argument("--stats").help("print parsing statistics and cppdwarf performance counters").flag();
+    parser.add_argument("--progress").help("log how much of .debug_info was parsed every second").flag();
     try {
         parser.parse_args(argc, argv);
     }
@@ -27,23 +96,67 @@ int main(int argc, char *argv[])
         return 1;
     }
 
+    auto trace_path = parser.present("--trace");
+    if (trace_path) {
+        trace::start();
+        trace::name_thread("main");
+    }
+
     auto path = parser.get<std::string>("path");
-    auto debug = dw::debug(path);
-    auto dbg_parser = debug_parser(debug);
+    auto show_stats = parser.get<bool>("--stats");
+    dw::debug::options options;
+    options.count_errors = show_stats;
+    options.preload_sections = parser.get<bool>("--preload");
+    auto debug = dw::debug(path, options);
+    if (options.preload_sections && !debug.object()) {
+        spdlog::info("sections of {} cannot be preloaded, libdwarf loads them", path);
+    }
+    auto manifest_path = parser.present("--manifest");
+    auto dbg_parser = manifest_path ? debug_parser(debug, manifest::load(*manifest_path)) : debug_parser(debug);
+    dw::scan_monitor monitor(parser.get<bool>("--progress") ? dw::scan_monitor::sink(log_progress) : nullptr,
+                             interrupted, std::chrono::seconds(1));
+    dbg_parser.set_monitor(&monitor);
+    std::signal(SIGINT, on_interrupt);
     auto &result = dbg_parser.parse();
-    auto base_dir = result.base_dir;
-    for (const auto &[filename, content] : result.files) {
-        if (posixpath::commonpath({filename, base_dir}) != base_dir) {
-            continue;
+    monitor.finish();
+    if (monitor.cancelled()) {
+        const auto progress = monitor.progress();
+        spdlog::warn("interrupted after {} of {} CUs, nothing written", progress.units_done, progress.units_total);
+        if (trace_path) {
+            trace::finish(*trace_path);
+        }
+        return 130;
+    }
+    if (show_stats) {
+        const auto &stats = dbg_parser.stats();
+        spdlog::info("parsed {} CUs ({} unchanged), visited {} DIEs, collected {} entries", stats.units,
+                     stats.restored_units, stats.visited_dies, stats.entries);
+        spdlog::info("largest CU parser state: {:.1f} KiB", static_cast<double>(stats.peak_unit_state) / 1024);
+        spdlog::info("libdwarf reported {} errors", debug.errors()->total());
+        for (const auto &entry : debug.errors()->summary()) {
+            spdlog::info("  {:>8} {}", entry.count, entry.name);
         }
-        auto relpath = posixpath::relpath(filename, base_dir);
+        for (const auto &section : debug.section_load_times()) {
+            spdlog::info("  {:<24} {:>10} -> {:>10} bytes {:>8.2f} ms", section.name, section.file_size, section.size,
+                         std::chrono::duration<double, std::milli>(section.elapsed).count());
+        }
+        log_perf_stats(dw::debug::stats());
+        log_memory(debug.memory(), dw::debug::heap());
+    }
 
-        fs::path output_file = fs::path("output") / relpath;
-        create_directories(output_file.parent_path());
+    auto writer = file_writer("output", static_cast<unsigned>(std::max(0, parser.get<int>("--jobs"))));
+    auto stats = writer.write(result);
+    auto seconds = stats.elapsed.count();
+    spdlog::info("wrote {} files ({} unchanged, {} skipped, {} removed, {:.1f} MiB) in {:.2f}s, {:.0f} files/s",
+                 stats.written, stats.unchanged, stats.skipped, stats.removed,
+                 static_cast<double>(stats.bytes) / (1024 * 1024), seconds,
+                 seconds > 0 ? static_cast<double>(stats.written + stats.unchanged) / seconds : 0.0);
 
-        spdlog::info("writing to {}", output_file);
-        std::ofstream out(output_file.string());
-        out << content;
+    if (manifest_path) {
+        dbg_parser.current_manifest().save(*manifest_path);
+    }
+    if (trace_path) {
+        trace::finish(*trace_path);
     }
     return 0;
 }
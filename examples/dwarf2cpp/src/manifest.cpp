@@ -0,0 +1,272 @@
+#include "dwarf2cpp/manifest.h"
+
+#include <fstream>
+
+#include <nlohmann/json.hpp>
+
+namespace {
+constexpr int manifest_version = 3;
+
+class fnv1a {
+public:
+    void add(const void *data, std::size_t size)
+    {
+        const auto *bytes = static_cast<const unsigned char *>(data);
+        for (std::size_t i = 0; i < size; ++i) {
+            hash_ = (hash_ ^ bytes[i]) * 0x100000001b3ULL;
+        }
+    }
+
+    template <typename T>
+    void add(const T &value)
+    {
+        static_assert(std::is_trivially_copyable_v<T>);
+        add(&value, sizeof(value));
+    }
+
+    void add(const std::string &value)
+    {
+        add(value.size());
+        add(value.data(), value.size());
+    }
+
+    [[nodiscard]] std::uint64_t value() const
+    {
+        return hash_;
+    }
+
+private:
+    std::uint64_t hash_ = 0xcbf29ce484222325ULL;
+};
+
+void hash_files(const std::vector<path_table::id> &src_files, const path_table &paths, fnv1a &hash)
+{
+    for (const auto file : src_files) {
+        hash.add(file == path_table::npos ? std::string() : paths[file]);
+    }
+}
+
+void hash_die(const dw::die &die, fnv1a &hash) // NOLINT(*-no-recursion)
+{
+    hash.add(die.tag());
+    for (const auto &attr : die.attributes()) {
+        hash.add(attr->type());
+        hash.add(attr->form());
+        // Addresses and references are left out: they shift whenever anything before this CU changes, while the
+        // values they point to are already covered by the rest of the tree.
+        if (attr->is_string()) {
+            hash.add(attr->get<std::string>());
+        }
+        else if (attr->is_integer()) {
+            hash.add(attr->get<std::int64_t>());
+        }
+        else if (attr->is_boolean()) {
+            hash.add(attr->get<bool>());
+        }
+    }
+    for (const auto &child : die) {
+        hash_die(child, hash);
+    }
+    hash.add(dw::tag{}); // end of children
+}
+
+// the attributes whose expressions hold addresses
+bool holds_addresses(dw::attribute_t type)
+{
+    switch (type) {
+    case dw::attribute_t::location:
+    case dw::attribute_t::frame_base:
+    case dw::attribute_t::return_addr:
+    case dw::attribute_t::static_link:
+    case dw::attribute_t::call_value:
+    case dw::attribute_t::call_target:
+    case dw::attribute_t::call_data_location:
+    case dw::attribute_t::call_data_value:
+    case dw::attribute_t::GNU_call_site_value:
+    case dw::attribute_t::GNU_call_site_target:
+        return true;
+    default:
+        return false;
+    }
+}
+
+// Hashes what a DIE decodes to rather than its bytes, which hold offsets into other sections (abbreviations, strings,
+// line tables, range lists) and addresses that all move when anything before the unit changes. Strings, constants,
+// flags and expressions without addresses are hashed by value, references within the unit by their offset from its
+// start; addresses, section offsets and references into other units only by their form.
+void hash_decoded(const dw::native::die &die, std::size_t depth, const dw::native::unit &unit, fnv1a &hash)
+{
+    hash.add(depth);
+    hash.add(die.tag());
+    for (const auto &attr : die.attributes()) {
+        hash.add(attr.type());
+        hash.add(attr.form());
+        if (attr.is_string()) {
+            const auto str = attr.get<std::string_view>();
+            hash.add(str.size());
+            hash.add(str.data(), str.size());
+        }
+        else if (attr.is_integer()) {
+            hash.add(attr.get<std::int64_t>());
+        }
+        else if (attr.is_boolean()) {
+            hash.add(attr.get<bool>());
+        }
+        else if (attr.is_reference()) {
+            const auto target = attr.reference();
+            if (target >= unit.offset() && target - unit.offset() < unit.length()) {
+                hash.add(target - unit.offset());
+            }
+        }
+        else if (attr.is_block() && !holds_addresses(attr.type())) {
+            const auto [data, size] = attr.block();
+            hash.add(size);
+            hash.add(data, size);
+        }
+    }
+}
+
+void hash_decoded(const dw::native::unit &unit, fnv1a &hash)
+{
+    struct visitor {
+        const dw::native::unit &unit;
+        fnv1a &hash;
+
+        void enter(const dw::native::die &die, const dw::walk_context &context)
+        {
+            hash_decoded(die, context.depth + 1, unit, hash);
+        }
+    };
+    const auto root = unit.die();
+    if (!root.is_null()) {
+        hash_decoded(root, 0, unit, hash);
+        dw::native::walker().walk(root, visitor{unit, hash});
+    }
+}
+
+std::string source_key(const manifest::cached_source &source)
+{
+    std::string key;
+    for (const auto &ns : source.namespaces) {
+        key += ns;
+        key += "::";
+    }
+    key += '\0';
+    key += source.source;
+    return key;
+}
+} // namespace
+
+manifest manifest::load(const std::filesystem::path &path)
+{
+    manifest result;
+    std::ifstream in(path);
+    if (!in) {
+        return result;
+    }
+
+    auto json = nlohmann::json::parse(in, nullptr, false);
+    if (json.is_discarded() || json.value("version", 0) != manifest_version) {
+        return result;
+    }
+
+    for (const auto &item : json.at("sources")) {
+        result.intern({static_cast<entry::kind_t>(item.at("kind").get<int>()),
+                       item.at("namespaces").get<entry::namespace_list>(), item.at("source").get<std::string>()});
+    }
+    for (const auto &[key, value] : json.at("units").items()) {
+        auto &u = result.add(key, value.at("fingerprint").get<std::uint64_t>());
+        for (const auto &c : value.at("contributions")) {
+            u.contributions.push_back({c.at(0).get<std::string>(), c.at(1).get<std::size_t>(),
+                                       c.at(2).get<std::size_t>()});
+        }
+    }
+    return result;
+}
+
+void manifest::save(const std::filesystem::path &path) const
+{
+    nlohmann::json sources = nlohmann::json::array();
+    for (const auto &source : sources_) {
+        sources.push_back({
+            {"kind", static_cast<int>(source.kind)},
+            {"namespaces", source.namespaces},
+            {"source", source.source},
+        });
+    }
+
+    nlohmann::json units = nlohmann::json::object();
+    for (const auto &[key, u] : units_) {
+        nlohmann::json contributions = nlohmann::json::array();
+        for (const auto &c : u.contributions) {
+            contributions.push_back({c.file, c.line, c.source});
+        }
+        units[key] = {
+            {"fingerprint", u.fingerprint},
+            {"contributions", std::move(contributions)},
+        };
+    }
+
+    nlohmann::json json = {
+        {"version", manifest_version},
+        {"sources", std::move(sources)},
+        {"units", std::move(units)},
+    };
+
+    if (path.has_parent_path()) {
+        std::filesystem::create_directories(path.parent_path());
+    }
+    std::ofstream out(path);
+    if (!out) {
+        throw std::runtime_error("failed to open " + path.string());
+    }
+    out << json.dump();
+}
+
+std::uint64_t manifest::fingerprint(const dw::compilation_unit &cu, const std::vector<path_table::id> &src_files,
+                                   const path_table &paths)
+{
+    fnv1a hash;
+    hash.add('d');
+    hash.add(cu.version());
+    hash_files(src_files, paths, hash);
+    hash_die(cu.die(), hash);
+    return hash.value();
+}
+
+std::uint64_t manifest::fingerprint(const dw::native::unit &unit, const std::vector<path_table::id> &src_files,
+                                   const path_table &paths)
+{
+    fnv1a hash;
+    hash.add('n');
+    hash.add(unit.version());
+    hash.add(unit.unit_type());
+    hash.add(unit.address_size());
+    hash.add(unit.offset_size());
+    hash_files(src_files, paths, hash);
+    hash_decoded(unit, hash);
+    return hash.value();
+}
+
+const manifest::unit *manifest::find(const std::string &key) const
+{
+    auto it = units_.find(key);
+    return it == units_.end() ? nullptr : &it->second;
+}
+
+manifest::unit &manifest::add(const std::string &key, std::uint64_t fingerprint)
+{
+    auto &u = units_[key];
+    u.fingerprint = fingerprint;
+    u.contributions.clear();
+    return u;
+}
+
+std::size_t manifest::intern(cached_source source)
+{
+    auto [it, inserted] = source_index_.emplace(source_key(source), sources_.size());
+    if (inserted) {
+        sources_.push_back(std::move(source));
+    }
+    return it->second;
+}
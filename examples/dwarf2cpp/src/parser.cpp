@@ -1,47 +1,197 @@
 #include "dwarf2cpp/parser.h"
 
+#include <algorithm>
+
 #include <spdlog/fmt/ostr.h>
 #include <spdlog/spdlog.h>
 
+#include "dwarf2cpp/templates.h"
+#include "dwarf2cpp/trace.h"
+
 const debug_parser::result &debug_parser::parse()
 {
+    trace::span span("debug_parser::parse");
     int i = 0;
-    for (auto &cu : dbg_) {
+    std::unordered_map<std::string, int> seen_units;
+    // the dies and attribute lists of one CU are only needed while it is parsed, the previous CU's are gone by the
+    // time the next one starts
+    dw::arena arena;
+    // building the unit table before the iteration starts gives the total up front
+    const auto total = dbg_.units().size();
+    if (previous_) {
+        try {
+            native_ = std::make_unique<dw::native::reader>(dbg_);
+        }
+        catch (const dw::init_error &err) {
+            spdlog::debug("fingerprinting CUs through libdwarf: {}", err.what());
+        }
+    }
+    for (auto &cu : monitor_ ? dbg_.compilation_units(*monitor_) : dbg_.compilation_units()) {
+        arena.reset();
+        dw::arena::scope use_arena(arena);
+
         auto &cu_die = cu.die();
         auto name = cu_die.attributes().at(dw::attribute_t::name)->get<std::string>();
         auto comp_dir = cu_die.attributes().at(dw::attribute_t::comp_dir)->get<std::string>();
-        auto base_dir = posixpath::commonpath({name, comp_dir});
+        auto base_dir = std::string(posixpath::commonpath(name, comp_dir));
 
-        spdlog::info("[{:<4}] parsing {}", ++i, name);
+        trace::span cu_span("CU", name);
         cu_parser parser(cu, *this);
-        parser.parse();
+        if (previous_) {
+            // the same source file may be compiled into several CUs, give each of them its own key
+            auto key = posixpath::join(comp_dir, name);
+            if (auto n = seen_units[key]++; n > 0) {
+                key += "#" + std::to_string(n);
+            }
+            auto fingerprint = this->fingerprint(cu, parser.src_files());
+            const auto *unit = previous_->find(key);
+            if (unit && unit->fingerprint == fingerprint) {
+                spdlog::info("[{:>4}/{}] unchanged {}", ++i, total, name);
+                restore_unit(key, *unit);
+                ++stats_.restored_units;
+            }
+            else {
+                spdlog::info("[{:>4}/{}] parsing {}", ++i, total, name);
+                if (unit) {
+                    mark_dirty(*unit);
+                }
+                current_unit_ = &current_.add(key, fingerprint);
+                parser.parse();
+                current_unit_ = nullptr;
+            }
+        }
+        else {
+            spdlog::info("[{:>4}/{}] parsing {}", ++i, total, name);
+            parser.parse();
+        }
+        stats_.visited_dies += parser.visited_dies();
+        stats_.peak_unit_state = std::max(stats_.peak_unit_state, parser.memory_usage());
+        if (parser.cancelled()) {
+            spdlog::warn("cancelled while parsing {}", name);
+            break;
+        }
+        dies_visited(parser.visited_dies() % dw::scan_monitor::die_interval);
+        ++stats_.units;
         if (result_.base_dir.empty()) {
             result_.base_dir = base_dir;
         }
-        result_.base_dir = posixpath::commonpath({base_dir, result_.base_dir});
+        result_.base_dir = std::string(posixpath::commonpath(base_dir, result_.base_dir));
+    }
+
+    if (previous_) {
+        // files that only removed CUs contributed to must be regenerated as well
+        for (const auto &[key, unit] : previous_->units()) {
+            if (!current_.find(key)) {
+                mark_dirty(unit);
+            }
+        }
     }
     return result_;
 }
 
+std::uint64_t debug_parser::fingerprint(dw::compilation_unit &cu, const std::vector<path_table::id> &src_files)
+{
+    if (native_) {
+        const auto &unit = native_->unit_at(cu.die().offset());
+        return manifest::fingerprint(unit, src_files, result_.paths);
+    }
+    return manifest::fingerprint(cu, src_files, result_.paths);
+}
+
+void debug_parser::add_entry(path_table::id file, std::size_t line, std::unique_ptr<entry> entry)
+{
+    ++stats_.entries;
+    if (current_unit_) {
+        auto source = current_.intern({entry->kind(), entry->namespaces(), entry->to_source()});
+        current_unit_->contributions.push_back({result_.paths[file], line, source});
+        result_.dirty_files->insert(file);
+    }
+    result_.files[file].add(line, std::move(entry));
+}
+
+void debug_parser::restore_unit(const std::string &key, const manifest::unit &unit)
+{
+    auto &restored = current_.add(key, unit.fingerprint);
+    for (const auto &c : unit.contributions) {
+        const auto &source = previous_->source(c.source);
+        restored.contributions.push_back({c.file, c.line, current_.intern(source)});
+        result_.files[result_.paths.intern(c.file)].add(
+            c.line, std::make_unique<cached_entry>(source.kind, source.source, source.namespaces));
+    }
+}
+
+void debug_parser::mark_dirty(const manifest::unit &unit)
+{
+    for (const auto &c : unit.contributions) {
+        result_.dirty_files->insert(result_.paths.intern(c.file));
+    }
+}
+
 cu_parser::cu_parser(dw::compilation_unit &cu, debug_parser &dbg_parser) : cu_(cu), dbg_parser_(dbg_parser)
 {
-    auto &cu_die = cu.die();
-    src_files_ = cu_die.src_files();
+    auto &paths = dbg_parser_.result_.paths;
+    for (const auto &file : cu.die().src_files()) {
+        src_files_.push_back(file.empty() ? path_table::npos : paths.intern_raw(file));
+    }
 }
 
 void cu_parser::parse()
 {
-    std::vector<std::string> parents;
+    // single traversal: record all types with names and collect the entries to parse
+    {
+        trace::span span("type pass");
+        collect();
+    }
+    if (cancelled_) {
+        candidates_.clear();
+        return;
+    }
 
-    // first pass: parse all types with names
-    parse_types(cu_.die(), parents);
+    // fix-up pass: every named type is known by now, so forward type references resolve
+    trace::span span("entry pass");
+    for (auto &[offset, file, line, entry] : candidates_) {
+        entry->parse(cu_.die_at(offset), *this);
+        add_entry(file, line, std::move(entry));
+    }
+    candidates_.clear();
+}
+
+std::size_t cu_parser::memory_usage() const
+{
+    // a std::unordered_map node holds the value and a pointer to the next node, and every bucket is a pointer
+    constexpr std::size_t node_overhead = sizeof(void *);
+    auto string_bytes = [](const std::string &str) {
+        return str.capacity() > std::string().capacity() ? str.capacity() + 1 : 0; // beyond the small string buffer
+    };
+    auto strings_bytes = [&](const std::vector<std::string> &strings) {
+        auto bytes = strings.capacity() * sizeof(std::string);
+        for (const auto &str : strings) {
+            bytes += string_bytes(str);
+        }
+        return bytes;
+    };
 
-    // second pass: parse all functions and classes
-    parse_children(cu_.die(), parents);
+    auto bytes = (known_types_.bucket_count() + pending_templates_.bucket_count()) * sizeof(void *);
+    for (const auto &[offset, type] : known_types_) {
+        bytes += node_overhead + sizeof(std::pair<const std::size_t, type_t>) + string_bytes(type.type) +
+                 strings_bytes(type.before_type) + strings_bytes(type.after_type) + strings_bytes(type.after_name);
+    }
+    for (const auto &[offset, tmpl] : pending_templates_) {
+        bytes += node_overhead + sizeof(std::pair<const std::size_t, template_t>) + string_bytes(tmpl.qualified_name) +
+                 tmpl.parameters.capacity() * sizeof(template_t::parameter);
+    }
+    return bytes + candidates_.capacity() * sizeof(candidate) + src_files_.capacity() * sizeof(path_table::id);
 }
 
 type_t cu_parser::get_type(const dw::die &die) // NOLINT(*-no-recursion)
 {
+    if (auto pending = pending_templates_.find(die.offset()); pending != pending_templates_.end()) {
+        // erase first, so a parameter referring back to this type sees its plain DWARF name
+        auto tmpl = std::move(pending->second);
+        pending_templates_.erase(pending);
+        known_types_[die.offset()] = {resolve_template(tmpl)};
+    }
+
     auto it = known_types_.find(die.offset());
     if (it == known_types_.end()) {
         std::unique_ptr<dw::die> type;
@@ -118,50 +268,58 @@ type_t cu_parser::get_type(const dw::die &die) // NOLINT(*-no-recursion)
     return known_types_.at(die.offset());
 }
 
-void cu_parser::parse_types(const dw::die &die, namespace_list &parents) // NOLINT(*-no-recursion)
-{
-    for (const auto &child : die) {
-        if (known_types_.find(child.offset()) != known_types_.end()) {
-            continue;
-        }
+// Records named types and collects entry candidates in a single walk. `pushed[depth]` tells whether the DIE at that
+// depth added its name to `parents`, `type_depth` is the depth of the outermost class, struct, union or enum the walk
+// is in: nested types are only recorded by name, their entries are parsed as part of the enclosing type.
+struct cu_parser::collect_visitor {
+    cu_parser &parser;
+    namespace_list parents;
+    std::vector<bool> pushed;
+    std::optional<std::size_t> type_depth;
 
-        const auto tag = child.tag();
-        std::string name;
-        if (child.attributes().contains(dw::attribute_t::name)) {
-            name = child.attributes().at(dw::attribute_t::name)->get<std::string>();
-        }
+    dw::walk_result enter(const dw::die &die, const dw::walk_context &context)
+    {
+        pushed.resize(context.depth);
+        pushed.push_back(false);
+        if (++parser.visited_dies_ % dw::scan_monitor::die_interval == 0 &&
+            !parser.dbg_parser_.dies_visited(dw::scan_monitor::die_interval)) {
+            parser.cancelled_ = true;
+            return dw::walk_result::stop;
+        }
+        const bool in_type = type_depth.has_value();
+        const auto tag = die.tag();
+        auto [name_attr] = die.read<dw::attribute_t::name>();
+        std::string name = name_attr ? std::move(*name_attr) : std::string();
 
         switch (tag) {
         case dw::tag::namespace_: {
-            if (name == "__1" && parents.size() == 1 && parents.at(0) == "std") {
-                parse_types(child, parents);
+            if (!is_inline_namespace(parents, name)) {
+                push(std::move(name));
             }
-            else {
-                parents.push_back(name);
-                parse_types(child, parents);
-                parents.pop_back();
-            }
-            break;
+            return dw::walk_result::continue_;
         }
         case dw::tag::base_type: {
             if (name.empty()) {
                 name = "void";
             }
-            known_types_[child.offset()] = {get_qualified_name(parents, name)};
+            parser.known_types_[die.offset()] = {get_qualified_name(parents, name)};
             break;
         }
         case dw::tag::typedef_: {
             if (name.empty()) {
                 throw std::runtime_error("invalid typedef");
             }
-            known_types_[child.offset()] = {get_qualified_name(parents, name)};
+            parser.known_types_[die.offset()] = {get_qualified_name(parents, name)};
+            if (!in_type) {
+                parser.add_candidate(die, tag, name, parents);
+            }
             break;
         }
         case dw::tag::unspecified_type: {
             if (name.empty()) {
                 throw std::runtime_error("invalid unspecified type");
             }
-            known_types_[child.offset()] = {get_qualified_name(parents, name)};
+            parser.known_types_[die.offset()] = {get_qualified_name(parents, name)};
             break;
         }
         case dw::tag::class_type:
@@ -169,96 +327,228 @@ void cu_parser::parse_types(const dw::die &die, namespace_list &parents) // NOLI
         case dw::tag::union_type:
         case dw::tag::enumeration_type: {
             if (!name.empty()) {
-                known_types_[child.offset()] = {get_qualified_name(parents, name)};
+                parser.known_types_[die.offset()] = {get_qualified_name(parents, name)};
+                if (auto pos = name.find('<'); pos != std::string::npos) {
+                    if (auto parameters = get_template_parameters(die)) {
+                        parser.pending_templates_.emplace(
+                            die.offset(),
+                            template_t{get_qualified_name(parents, name.substr(0, pos)), std::move(*parameters)});
+                    }
+                }
+                if (!in_type) {
+                    parser.add_candidate(die, tag, name, parents);
+                }
+            }
+            if (!in_type) {
+                type_depth = context.depth;
+            }
+            push(std::move(name));
+            return dw::walk_result::continue_;
+        }
+        case dw::tag::subprogram: {
+            if (!in_type) {
+                parser.add_candidate(die, tag, name, parents);
             }
-            parents.push_back(name);
-            parse_types(child, parents);
-            parents.pop_back();
             break;
         }
         default: {
             break;
         }
         }
+        return dw::walk_result::skip;
     }
+
+    void leave(const dw::die & /*die*/, const dw::walk_context &context)
+    {
+        if (pushed[context.depth]) {
+            parents.pop_back();
+        }
+        if (type_depth == context.depth) {
+            type_depth.reset();
+        }
+    }
+
+    void push(std::string name)
+    {
+        parents.push_back(std::move(name));
+        pushed.back() = true;
+    }
+};
+
+void cu_parser::collect()
+{
+    // members, parameters, variables and function bodies are read later by the entries themselves
+    static const dw::tag_set tags{dw::tag::namespace_, dw::tag::base_type, dw::tag::typedef_,
+                                  dw::tag::unspecified_type, dw::tag::class_type, dw::tag::structure_type,
+                                  dw::tag::union_type, dw::tag::enumeration_type, dw::tag::subprogram};
+    dw::walker walker(tags);
+    walker.walk(cu_.die(), collect_visitor{*this, {}, {}, std::nullopt});
 }
 
-void cu_parser::parse_children(const dw::die &die, namespace_list &namespaces) // NOLINT(*-no-recursion)
+void cu_parser::add_candidate(const dw::die &die, dw::tag tag, const std::string &name,
+                              const namespace_list &namespaces)
 {
-    for (const auto &child : die) {
-        const auto tag = child.tag();
+    const auto [file_attr, line_attr] = die.read<dw::attribute_t::decl_file, dw::attribute_t::decl_line>();
+    path_table::id decl_file = path_table::npos;
+    int decl_line = 0;
+    if (file_attr) {
+        auto file_index = static_cast<int>(*file_attr);
+        if (cu_.version() < 5) {
+            file_index -= 1;
+        }
+        decl_file = src_files_.at(file_index);
+    }
+    if (line_attr) {
+        decl_line = static_cast<int>(*line_attr);
+    }
 
-        std::string name;
-        if (child.attributes().contains(dw::attribute_t::name)) {
-            name = child.attributes().at(dw::attribute_t::name)->get<std::string>();
-        }
+    if (name.empty() || decl_file == path_table::npos || decl_line <= 0) {
+        return;
+    }
+    std::unique_ptr<entry> entry;
+    switch (tag) {
+    case dw::tag::class_type: {
+        entry = std::make_unique<struct_t>(true, namespaces);
+        break;
+    }
+    case dw::tag::structure_type: {
+        entry = std::make_unique<struct_t>(false, namespaces);
+        break;
+    }
+    case dw::tag::union_type: {
+        entry = std::make_unique<union_t>(namespaces);
+        break;
+    }
+    case dw::tag::enumeration_type: {
+        entry = std::make_unique<enum_t>(namespaces);
+        break;
+    }
+    case dw::tag::subprogram: {
+        entry = std::make_unique<function_t>(false, namespaces);
+        break;
+    }
+    case dw::tag::typedef_: {
+        entry = std::make_unique<typedef_t>(namespaces);
+        break;
+    }
+    default:
+        return;
+    }
+    candidates_.push_back({die.offset(), decl_file, static_cast<std::size_t>(decl_line), std::move(entry)});
+}
 
-        if (tag == dw::tag::namespace_) {
-            if (name == "__1" && namespaces.size() == 1 && namespaces.at(0) == "std") {
-                parse_children(child, namespaces);
-            }
-            else {
-                namespaces.push_back(name);
-                parse_children(child, namespaces);
-                namespaces.pop_back();
-            }
-            continue;
-        }
+bool cu_parser::is_unsigned_type(const dw::die &type) // NOLINT(*-no-recursion)
+{
+    switch (type.tag()) {
+    case dw::tag::base_type: {
+        auto attr = type.try_attribute(dw::attribute_t::encoding);
+        auto encoding = attr ? attr->try_get<std::uint64_t>() : attr.error();
+        return encoding && (*encoding == DW_ATE_unsigned || *encoding == DW_ATE_unsigned_char ||
+                            *encoding == DW_ATE_boolean || *encoding == DW_ATE_UTF);
+    }
+    case dw::tag::typedef_:
+    case dw::tag::const_type:
+    case dw::tag::volatile_type:
+    case dw::tag::enumeration_type: {
+        // an enumeration's underlying type is only recorded since DWARF 3
+        auto attr = type.try_attribute(dw::attribute_t::type);
+        auto underlying = attr ? attr->try_get<dw::die>() : attr.error();
+        return underlying && is_unsigned_type(*underlying);
+    }
+    default:
+        return false;
+    }
+}
 
-        std::string decl_file;
-        int decl_line = 0;
-        if (child.attributes().contains(dw::attribute_t::decl_file)) {
-            int file_index = child.attributes().at(dw::attribute_t::decl_file)->get<int>();
-            if (cu_.version() < 5) {
-                file_index -= 1;
+std::optional<std::vector<cu_parser::template_t::parameter>> cu_parser::get_template_parameters(const dw::die &die)
+{
+    std::vector<template_t::parameter> parameters;
+    for (const auto &child : die) {
+        switch (child.tag()) {
+        // parameters are probed without throwing: anything missing or unexpected keeps the compiler's name
+        case dw::tag::template_type_parameter: {
+            auto type = child.try_attribute(dw::attribute_t::type);
+            auto type_die = type ? type->try_get<dw::die>() : type.error();
+            if (!type_die) {
+                return std::nullopt;
             }
-            decl_file = src_files_.at(file_index);
-        }
-        if (child.attributes().contains(dw::attribute_t::decl_line)) {
-            decl_line = child.attributes().at(dw::attribute_t::decl_line)->get<int>();
-        }
-
-        if (name.empty() || decl_file.empty() || decl_line <= 0) {
-            continue;
-        }
-        std::unique_ptr<entry> entry;
-        switch (tag) {
-        case dw::tag::class_type: {
-            entry = std::make_unique<struct_t>(true, namespaces);
-            break;
-        }
-        case dw::tag::structure_type: {
-            entry = std::make_unique<struct_t>(false, namespaces);
-            break;
-        }
-        case dw::tag::union_type: {
-            entry = std::make_unique<union_t>(namespaces);
-            break;
-        }
-        case dw::tag::enumeration_type: {
-            entry = std::make_unique<enum_t>(namespaces);
+            parameters.push_back({std::move(*type_die), std::nullopt});
             break;
         }
-        case dw::tag::subprogram: {
-            entry = std::make_unique<function_t>(false, namespaces);
+        case dw::tag::template_value_parameter: {
+            auto type = child.try_attribute(dw::attribute_t::type);
+            auto type_die = type ? type->try_get<dw::die>() : type.error();
+            auto const_value = child.try_attribute(dw::attribute_t::const_value);
+            // non-negative values of unsigned types may be above INT64_MAX, they are read with dwarf_formudata
+            auto value = const_value ? const_value->try_get<std::uint64_t>() : const_value.error();
+            if (!type_die || !value) {
+                return std::nullopt;
+            }
+            const auto is_unsigned = is_unsigned_type(*type_die);
+            parameters.push_back({std::move(*type_die), *value, is_unsigned});
             break;
         }
-        case dw::tag::typedef_: {
-            entry = std::make_unique<typedef_t>(namespaces);
-            break;
+        case dw::tag::GNU_template_parameter_pack:
+        case dw::tag::GNU_template_template_param: {
+            // cannot be reconstructed reliably, keep the name as emitted by the compiler
+            return std::nullopt;
         }
         default:
             break;
         }
+    }
+    if (parameters.empty()) {
+        return std::nullopt;
+    }
+    return parameters;
+}
 
-        if (entry) {
-            entry->parse(child, *this);
-            add_entry(decl_file, decl_line, std::move(entry));
+std::string cu_parser::resolve_template(const template_t &tmpl) // NOLINT(*-no-recursion)
+{
+    std::vector<std::string> args;
+    args.reserve(tmpl.parameters.size());
+    for (const auto &[type, value, is_unsigned] : tmpl.parameters) {
+        auto type_name = get_type(type).describe("");
+        if (!value.has_value()) {
+            args.push_back(std::move(type_name));
+        }
+        else if (type_name == "bool") {
+            args.emplace_back(value.value() ? "true" : "false");
+        }
+        else {
+            auto number = is_unsigned ? std::to_string(value.value())
+                                      : std::to_string(static_cast<std::int64_t>(value.value()));
+            if (type.tag() == dw::tag::enumeration_type) {
+                number = "(" + type_name + ")" + number;
+            }
+            args.push_back(std::move(number));
         }
     }
+    return format_template(tmpl.qualified_name, std::move(args));
+}
+
+std::string cu_parser::declared_name(const dw::die &die, const namespace_list &namespaces)
+{
+    auto [name_attr] = die.read<dw::attribute_t::name>();
+    std::string name = name_attr ? std::move(*name_attr) : std::string();
+    const auto pos = name.find('<');
+    if (pos == std::string::npos) {
+        return name;
+    }
+    auto parameters = get_template_parameters(die);
+    if (!parameters) {
+        return name;
+    }
+    // resolved with the qualified name, which the standard library's defaults are known by, and declared without it
+    const auto qualified_name = get_qualified_name(namespaces, name.substr(0, pos));
+    const auto resolved = resolve_template({qualified_name, std::move(*parameters)});
+    if (resolved.compare(0, qualified_name.size() + 1, qualified_name + "<") != 0) {
+        return name; // an alias such as std::string
+    }
+    return name.substr(0, pos) + resolved.substr(qualified_name.size());
 }
 
-void cu_parser::add_entry(std::string file, std::size_t line, std::unique_ptr<entry> entry) const
+void cu_parser::add_entry(path_table::id file, std::size_t line, std::unique_ptr<entry> entry) const
 {
-    dbg_parser_.add_entry(std::move(file), line, std::move(entry));
+    dbg_parser_.add_entry(file, line, std::move(entry));
 }
@@ -2,6 +2,8 @@
 
 #include <sstream>
 
+#include "dwarf2cpp/trace.h"
+
 void source_file::add(std::size_t line, std::unique_ptr<entry> new_entry)
 {
     lines_[line] = std::move(new_entry);
@@ -9,6 +11,7 @@ void source_file::add(std::size_t line, std::unique_ptr<entry> new_entry)
 
 std::string source_file::to_source() const
 {
+    trace::span span("source_file::to_source");
     std::stringstream ss;
     std::vector<std::string> prev_ns;
 
@@ -0,0 +1,113 @@
+#include "dwarf2cpp/templates.h"
+
+#include <functional>
+#include <unordered_map>
+
+namespace {
+using args_t = std::vector<std::string>;
+
+// A default template argument, expressed in terms of the preceding arguments.
+using default_arg = std::function<std::string(const args_t &)>;
+
+std::string allocator_of(const std::string &type)
+{
+    return "std::allocator<" + type + ">";
+}
+
+std::string pair_allocator_of(const args_t &args)
+{
+    return allocator_of("std::pair<" + args[0] + " const, " + args[1] + ">");
+}
+
+default_arg wrap(const char *tmpl, std::size_t index = 0)
+{
+    return [tmpl, index](const args_t &args) { return std::string(tmpl) + "<" + args[index] + ">"; };
+}
+
+// Default arguments of the standard library templates, indexed by the position of the parameter.
+const std::unordered_map<std::string, std::vector<default_arg>> &known_defaults()
+{
+    static const auto allocator = wrap("std::allocator");
+    static const auto less = wrap("std::less");
+    static const auto hash = wrap("std::hash");
+    static const auto equal_to = wrap("std::equal_to");
+    static const auto char_traits = wrap("std::char_traits");
+
+    static const std::unordered_map<std::string, std::vector<default_arg>> defaults = {
+        {"std::vector", {nullptr, allocator}},
+        {"std::list", {nullptr, allocator}},
+        {"std::forward_list", {nullptr, allocator}},
+        {"std::deque", {nullptr, allocator}},
+        {"std::queue", {nullptr, wrap("std::deque")}},
+        {"std::stack", {nullptr, wrap("std::deque")}},
+        {"std::priority_queue", {nullptr, wrap("std::vector"), less}},
+        {"std::set", {nullptr, less, allocator}},
+        {"std::multiset", {nullptr, less, allocator}},
+        {"std::map", {nullptr, nullptr, less, pair_allocator_of}},
+        {"std::multimap", {nullptr, nullptr, less, pair_allocator_of}},
+        {"std::unordered_set", {nullptr, hash, equal_to, allocator}},
+        {"std::unordered_multiset", {nullptr, hash, equal_to, allocator}},
+        {"std::unordered_map", {nullptr, nullptr, hash, equal_to, pair_allocator_of}},
+        {"std::unordered_multimap", {nullptr, nullptr, hash, equal_to, pair_allocator_of}},
+        {"std::unique_ptr", {nullptr, wrap("std::default_delete")}},
+        {"std::basic_string", {nullptr, char_traits, allocator}},
+        {"std::basic_string_view", {nullptr, char_traits}},
+    };
+    return defaults;
+}
+
+const std::unordered_map<std::string, std::unordered_map<std::string, std::string>> &known_aliases()
+{
+    static const std::unordered_map<std::string, std::unordered_map<std::string, std::string>> aliases = {
+        {"std::basic_string",
+         {
+             {"char", "std::string"},
+             {"wchar_t", "std::wstring"},
+             {"char8_t", "std::u8string"},
+             {"char16_t", "std::u16string"},
+             {"char32_t", "std::u32string"},
+         }},
+        {"std::basic_string_view",
+         {
+             {"char", "std::string_view"},
+             {"wchar_t", "std::wstring_view"},
+             {"char8_t", "std::u8string_view"},
+             {"char16_t", "std::u16string_view"},
+             {"char32_t", "std::u32string_view"},
+         }},
+    };
+    return aliases;
+}
+} // namespace
+
+std::string format_template(const std::string &name, std::vector<std::string> args)
+{
+    if (auto it = known_defaults().find(name); it != known_defaults().end()) {
+        const auto &defaults = it->second;
+        while (args.size() > 1 && args.size() <= defaults.size()) {
+            const auto &default_arg = defaults[args.size() - 1];
+            if (!default_arg || default_arg(args) != args.back()) {
+                break;
+            }
+            args.pop_back();
+        }
+    }
+
+    if (args.size() == 1) {
+        if (auto it = known_aliases().find(name); it != known_aliases().end()) {
+            if (auto alias = it->second.find(args[0]); alias != it->second.end()) {
+                return alias->second;
+            }
+        }
+    }
+
+    std::string result = name + "<";
+    for (std::size_t i = 0; i < args.size(); ++i) {
+        if (i > 0) {
+            result += ", ";
+        }
+        result += args[i];
+    }
+    result += ">";
+    return result;
+}
@@ -0,0 +1,123 @@
+#include "dwarf2cpp/trace.h"
+
+#include <fstream>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+namespace trace {
+namespace {
+
+struct event {
+    const char *name;
+    std::string arg;
+    clock::time_point start;
+    clock::time_point end;
+};
+
+// written only by its thread while tracing is on, read by finish() once the threads are done
+struct thread_buffer {
+    std::size_t tid = 0;
+    std::string name;
+    std::vector<event> events;
+};
+
+struct registry {
+    std::mutex mutex; // only taken when a thread records its first span
+    std::vector<std::unique_ptr<thread_buffer>> buffers;
+    clock::time_point origin;
+};
+
+registry &get_registry()
+{
+    static registry r;
+    return r;
+}
+
+thread_buffer &local_buffer()
+{
+    // the registry owns the buffer, so the spans of a thread survive it
+    thread_local thread_buffer *buffer = nullptr;
+    if (!buffer) {
+        auto &r = get_registry();
+        std::lock_guard lock(r.mutex);
+        auto &b = r.buffers.emplace_back(std::make_unique<thread_buffer>());
+        b->tid = r.buffers.size();
+        b->events.reserve(1024);
+        buffer = b.get();
+    }
+    return *buffer;
+}
+
+std::string quote(const std::string &str)
+{
+    return nlohmann::json(str).dump(-1, ' ', false, nlohmann::json::error_handler_t::replace);
+}
+
+double microseconds(clock::duration d)
+{
+    return std::chrono::duration<double, std::micro>(d).count();
+}
+
+} // namespace
+
+void details::record(const char *name, std::string arg, clock::time_point start, clock::time_point end)
+{
+    local_buffer().events.push_back({name, std::move(arg), start, end});
+}
+
+void start()
+{
+    get_registry().origin = clock::now();
+    details::enabled = true;
+}
+
+void name_thread(std::string name)
+{
+    if (enabled()) {
+        local_buffer().name = std::move(name);
+    }
+}
+
+void finish(const std::filesystem::path &path)
+{
+    details::enabled = false;
+    auto &r = get_registry();
+    std::lock_guard lock(r.mutex);
+
+    std::ofstream out(path);
+    if (!out) {
+        throw std::runtime_error("failed to open " + path.string());
+    }
+    // complete events ("ph": "X") carry their duration, so every span is a single record
+    out << std::fixed << std::setprecision(3);
+    out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+    bool first = true;
+    auto separate = [&]() {
+        out << (first ? "\n" : ",\n");
+        first = false;
+    };
+    for (const auto &buffer : r.buffers) {
+        if (!buffer->name.empty()) {
+            separate();
+            out << R"({"name":"thread_name","ph":"M","pid":1,"tid":)" << buffer->tid << R"(,"args":{"name":)"
+                << quote(buffer->name) << "}}";
+        }
+        for (const auto &e : buffer->events) {
+            separate();
+            out << R"({"name":)" << quote(e.name) << R"(,"ph":"X","pid":1,"tid":)" << buffer->tid
+                << R"(,"ts":)" << microseconds(e.start - r.origin) << R"(,"dur":)" << microseconds(e.end - e.start);
+            if (!e.arg.empty()) {
+                out << R"(,"args":{"detail":)" << quote(e.arg) << "}";
+            }
+            out << "}";
+        }
+    }
+    out << "\n]}\n";
+}
+
+} // namespace trace
@@ -0,0 +1,162 @@
+#include "dwarf2cpp/writer.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <fstream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <spdlog/fmt/std.h>
+#include <spdlog/spdlog.h>
+
+#include "dwarf2cpp/posixpath.hpp"
+#include "dwarf2cpp/trace.h"
+
+namespace fs = std::filesystem;
+
+file_writer::file_writer(fs::path output_dir, unsigned jobs) : output_dir_(std::move(output_dir)), jobs_(jobs)
+{
+    if (jobs_ == 0) {
+        jobs_ = std::max(1U, std::thread::hardware_concurrency());
+    }
+}
+
+file_writer::stats file_writer::write(const debug_parser::result &result)
+{
+    const auto start = std::chrono::steady_clock::now();
+    const auto &base_dir = result.base_dir;
+
+    std::size_t skipped = 0;
+    std::vector<std::pair<fs::path, const source_file *>> tasks;
+    tasks.reserve(result.files.size());
+    for (const auto &[file_id, content] : result.files) {
+        const auto &filename = result.paths[file_id];
+        if (posixpath::commonpath(filename, base_dir) != base_dir) {
+            continue;
+        }
+        auto output_file = output_dir_ / posixpath::relpath(filename, base_dir);
+        if (result.dirty_files && result.dirty_files->find(file_id) == result.dirty_files->end() &&
+            fs::exists(output_file)) {
+            ++skipped;
+            continue;
+        }
+        tasks.emplace_back(std::move(output_file), &content);
+    }
+
+    // A dirty file without content lost its last contributor to a changed or removed CU, its output from a previous
+    // run is stale.
+    std::size_t removed = 0;
+    if (result.dirty_files) {
+        for (const auto file_id : *result.dirty_files) {
+            const auto &filename = result.paths[file_id];
+            if (result.files.find(file_id) != result.files.end() ||
+                posixpath::commonpath(filename, base_dir) != base_dir) {
+                continue;
+            }
+            const auto output_file = output_dir_ / posixpath::relpath(filename, base_dir);
+            std::error_code ec;
+            if (fs::remove(output_file, ec)) {
+                spdlog::debug("removed {}", output_file);
+                ++removed;
+            }
+            else if (ec) {
+                throw std::runtime_error("failed to remove " + output_file.string() + ": " + ec.message());
+            }
+        }
+    }
+
+    std::atomic<std::size_t> next{0};
+    std::atomic<std::size_t> written{0};
+    std::atomic<std::size_t> unchanged{0};
+    std::atomic<std::size_t> bytes{0};
+    std::mutex error_mutex;
+    std::exception_ptr error;
+
+    auto worker = [&](std::size_t index) {
+        trace::name_thread("writer " + std::to_string(index));
+        for (auto i = next++; i < tasks.size(); i = next++) {
+            const auto &[output_file, file] = tasks[i];
+            trace::span span("render and write", output_file.string());
+            try {
+                const auto content = file->to_source();
+                if (write_file(output_file, content)) {
+                    ++written;
+                    bytes += content.size();
+                }
+                else {
+                    ++unchanged;
+                }
+            }
+            catch (...) {
+                std::lock_guard lock(error_mutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+                next = tasks.size(); // stop the other workers
+            }
+        }
+    };
+
+    const auto num_threads = std::min<std::size_t>(jobs_, tasks.size());
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    for (std::size_t i = 0; i < num_threads; ++i) {
+        threads.emplace_back(worker, i);
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    if (error) {
+        std::rethrow_exception(error);
+    }
+
+    stats s;
+    s.written = written;
+    s.unchanged = unchanged;
+    s.skipped = skipped;
+    s.removed = removed;
+    s.bytes = bytes;
+    s.elapsed = std::chrono::steady_clock::now() - start;
+    return s;
+}
+
+bool file_writer::write_file(const fs::path &path, const std::string &content)
+{
+    trace::span span("file_writer::write_file");
+    // Leave files untouched when their content has not changed, so their timestamps survive a rerun.
+    std::error_code ec;
+    if (const auto size = fs::file_size(path, ec); !ec && size == content.size()) {
+        std::ifstream in(path, std::ios::binary);
+        std::string existing(size, '\0');
+        if (in.read(existing.data(), static_cast<std::streamsize>(size)) && existing == content) {
+            spdlog::debug("unchanged {}", path);
+            return false;
+        }
+    }
+
+    create_directories(path.parent_path());
+    spdlog::debug("writing to {}", path);
+    std::ofstream out(path, std::ios::binary);
+    if (!out) {
+        throw std::runtime_error("failed to open " + path.string());
+    }
+    out.write(content.data(), static_cast<std::streamsize>(content.size()));
+    // a full disk shows up on the write or only when the buffer is flushed by close()
+    out.close();
+    if (!out) {
+        throw std::runtime_error("failed to write " + path.string());
+    }
+    return true;
+}
+
+void file_writer::create_directories(const fs::path &dir)
+{
+    std::lock_guard lock(dirs_mutex_);
+    auto key = dir.string();
+    if (created_dirs_.find(key) == created_dirs_.end()) {
+        fs::create_directories(dir);
+        created_dirs_.insert(std::move(key));
+    }
+}
@@ -9,16 +9,6 @@ import re
 from tqdm import tqdm
 
 
-def recursive_sub(pattern: str, repl: str, content: str):
-    while True:
-        output = re.sub(pattern, repl, content)
-        if output == content:
-            break
-        content = output
-
-    return content
-
-
 def process_file(args):
     """
     Process a single file. Replace this with your file handling logic.
@@ -28,48 +18,16 @@ def process_file(args):
     with open(file_path, "r", encoding="utf-8") as f:
         content = f.read()
 
-    # Replace every occurrence of 'std::__1::' with 'std::'
-    content = content.replace("std::__1::", "std::")
-    content = content.replace(
-        "std::basic_string<char, std::char_traits<char>, std::allocator<char> >",
-        "std::string",
-    )
-    content = content.replace(
-        "std::basic_string_view<char, std::char_traits<char> >",
-        "std::string_view",
-    )
-    content = content.replace(
-        "std::chrono::time_point<std::chrono::steady_clock, std::chrono::duration<long long, std::ratio<1L, 1000000000L> > >",
-        "std::chrono::steady_clock::time_point",
-    )
+    # dwarf2cpp rebuilds the template arguments of the type names and declared entities it writes, dropping the
+    # standard library's default arguments and inline namespaces, see src/templates.cpp. Only specializations with
+    # parameter packs or template template parameters keep the compiler's names, whose inline namespaces are dropped
+    # here; the rest are rewrites for the projects dwarf2cpp is run on.
+    content = content.replace("std::__1::", "std::").replace("std::__cxx11::", "std::")
     content = re.sub(r"\(lambda at .+?\)", "Lambda", content)
 
     pattern_repl = [
-        # std::unique_ptr
-        (r"std::unique_ptr<(.+?),\s*std::default_delete<\1\s*>\s*>", r"std::unique_ptr<\1>"),
-        # std::vector
-        (r"std::vector<(.+?),\s*std::allocator<\1\s*>\s*>", r"std::vector<\1>"),
-        # std::list
-        (r"std::list<(.+?),\s*std::allocator<\1\s*>\s*>", r"std::list<\1>"),
-        # std::deque
-        (r"std::deque<(.+?),\s*std::allocator<\1\s*>\s*>", r"std::deque<\1>"),
-        # std::queue
-        (r"std::queue<(.+?),\s*std::deque<\1\s*>\s*>", r"std::queue<\1>"),
-        # std::unordered_map
-        (r"std::unordered_map<(.+?),\s*(.+?),\s*"
-         r"std::hash<\1\s*>,\s*"
-         r"std::equal_to<\1\s*>,\s*"
-         r"std::allocator<std::pair<const \1,\s*\2\s*>\s*>\s*>", r"std::unordered_map<\1, \2>"),
-        # std::unordered_set
-        (r"std::unordered_set<(.+?),\s*std::hash<\1\s*>,\s*"
-         r"std::equal_to<\1\s*>,\s*std::allocator<\1\s*>\s*>", r"std::unordered_set<\1>"),
-        # std::map
-        (r"std::map<(.+?),\s*(.+?),\s*std::less<\1\s*>,\s*"
-         r"std::allocator<std::pair<const \1,\s*\2\s*>\s*>\s*>", r"std::map<\1, \2>"),
-        # std::set
-        (r"std::set<(.+?),\s*std::less<\1\s*>,\s*std::allocator<\1\s*>\s*>", r"std::set<\1>"),
         # gsl::span
-        (r"gsl::span<(.+),\s*\d+UL>", r"gsl::span<\1>"),
+        (r"gsl::span<(.+),\s*\d+(?:UL)?>", r"gsl::span<\1>"),
         # glm::vec
         (r"glm::vec<(\d),\s*float,\s*\(glm::qualifier\)0>", r"glm::vec\1"),
         # glm::mat
@@ -78,16 +36,8 @@ def process_file(args):
         (r"((?:union|enum|struct|class)\s*{[\s\S]+?});\s*(\1\s.+)", r"\2"),
         (r"((?:union|enum|struct|class)\s*{[\s\S]+?})(.+)(\s*\1;)", r"\1\2"),
     ]
-
-    while True:
-        output = content
-        for pattern, repl in pattern_repl:
-            output = re.sub(pattern, repl, output)
-
-        if output == content:
-            break
-
-        content = output
+    for pattern, repl in pattern_repl:
+        content = re.sub(pattern, repl, content)
 
     # Calculate relative path
     relative_path = file_path.relative_to(input_path)
@@ -1,84 +1,457 @@
-#include <filesystem>
+#include <algorithm>
+#include <chrono>
+#include <csignal>
+#include <cstdint>
+#include <deque>
+#include <exception>
 #include <fstream>
-#include <unordered_set>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
 
 #include <argparse/argparse.hpp>
 #include <cppdwarf/cppdwarf.hpp>
-#include <nlohmann/json.hpp>
 #include <spdlog/spdlog.h>
 
 namespace dw = cppdwarf;
-namespace fs = std::filesystem;
 
-std::unordered_map<std::string, std::unordered_set<nlohmann::json>> result;
+// Interns strings, so records can refer to file and type names by a 32-bit id
+class string_table {
+public:
+    std::uint32_t intern(std::string_view str)
+    {
+        if (auto it = ids_.find(str); it != ids_.end()) {
+            return it->second;
+        }
+        auto id = static_cast<std::uint32_t>(strings_.size());
+        ids_.emplace(strings_.emplace_back(str), id);
+        return id;
+    }
+
+    [[nodiscard]] const std::string &operator[](std::uint32_t id) const
+    {
+        return strings_[id];
+    }
+
+private:
+    std::deque<std::string> strings_; // never relocates, the string_view keys stay valid
+    std::unordered_map<std::string_view, std::uint32_t> ids_;
+};
+
+struct type_record {
+    std::uint32_t file;
+    std::uint32_t name;
+    std::uint32_t line;
+
+    bool operator==(const type_record &other) const
+    {
+        return file == other.file && name == other.name && line == other.line;
+    }
+};
+
+// Open addressing hash set of records, stored inline without a node allocation per element
+class record_set {
+public:
+    // returns false if the record was already present
+    bool insert(const type_record &record)
+    {
+        if ((size_ + 1) * 2 > slots_.size()) {
+            grow();
+        }
+        if (!insert_slot(record)) {
+            return false;
+        }
+        ++size_;
+        return true;
+    }
+
+    // the records in unspecified order
+    [[nodiscard]] std::vector<type_record> records() const
+    {
+        std::vector<type_record> result;
+        result.reserve(size_);
+        std::copy_if(slots_.begin(), slots_.end(), std::back_inserter(result),
+                     [](const type_record &slot) { return slot.name != empty; });
+        return result;
+    }
+
+    [[nodiscard]] std::size_t size() const
+    {
+        return size_;
+    }
+
+private:
+    static constexpr std::uint32_t empty = UINT32_MAX;
+
+    static std::size_t hash(const type_record &record)
+    {
+        std::uint64_t h = (static_cast<std::uint64_t>(record.file) << 32) ^ record.name;
+        h ^= static_cast<std::uint64_t>(record.line) * 0x9e3779b97f4a7c15ULL;
+        h ^= h >> 29;
+        h *= 0xbf58476d1ce4e5b9ULL;
+        return static_cast<std::size_t>(h ^ (h >> 32));
+    }
 
-std::string join(const std::vector<std::string> &strings, const std::string &delimiter)
+    bool insert_slot(const type_record &record)
+    {
+        const auto mask = slots_.size() - 1;
+        for (auto i = hash(record) & mask;; i = (i + 1) & mask) {
+            if (slots_[i].name == empty) {
+                slots_[i] = record;
+                return true;
+            }
+            if (slots_[i] == record) {
+                return false;
+            }
+        }
+    }
+
+    void grow()
+    {
+        std::vector<type_record> old(std::max<std::size_t>(16, slots_.size() * 2), type_record{0, empty, 0});
+        old.swap(slots_);
+        for (const auto &slot : old) {
+            if (slot.name != empty) {
+                insert_slot(slot);
+            }
+        }
+    }
+
+    std::vector<type_record> slots_;
+    std::size_t size_ = 0;
+};
+
+void write_json_string(std::ostream &os, std::string_view str)
 {
-    std::string result;
-    for (size_t i = 0; i < strings.size(); ++i) {
-        result += strings[i];
-        if (i < strings.size() - 1) {
-            result += delimiter;
+    static constexpr char hex[] = "0123456789abcdef";
+    os << '"';
+    for (const char c : str) {
+        switch (c) {
+        case '"':
+            os << "\\\"";
+            break;
+        case '\\':
+            os << "\\\\";
+            break;
+        case '\n':
+            os << "\\n";
+            break;
+        case '\t':
+            os << "\\t";
+            break;
+        default:
+            if (static_cast<unsigned char>(c) < 0x20) {
+                os << "\\u00" << hex[(c >> 4) & 0xf] << hex[c & 0xf];
+            }
+            else {
+                os << c;
+            }
+            break;
         }
     }
-    return result;
+    os << '"';
 }
 
-void parse(const dw::die &die, std::vector<std::string> &parents, const std::vector<std::string> &src_files)
+void write_ndjson_record(std::ostream &os, const std::string &file, const std::string &name, std::uint32_t line)
 {
-    for (const auto &child : die) {
-        const auto tag = child.tag();
-        std::string name;
-        if (auto it = child.find(dw::attribute_t::name); it != child.attributes().end()) {
-            name = it->get<std::string>();
-        }
-
-        switch (tag) {
-        case dw::tag::namespace_: {
-            if (name.empty()) {
-                // Assign a special name for anonymous namespaces
-                name = "__anonymous_namespace__";
-            }
-            parents.push_back(name);
-            parse(child, parents, src_files); // Recursive parsing of namespace
-            parents.pop_back();
-            break;
+    os << "{\"file\": ";
+    write_json_string(os, file);
+    os << ", \"line\": " << line << ", \"name\": ";
+    write_json_string(os, name);
+    os << "}\n";
+}
+
+class type_collector {
+public:
+    using callback = std::function<void(const std::string &file, const std::string &name, std::uint32_t line)>;
+
+    // `on_new` is called for every record the first time this collector sees it
+    explicit type_collector(callback on_new = nullptr) : on_new_(std::move(on_new)) {}
+
+    // the walks report the DIEs they visit to `monitor` and stop once it is cancelled
+    void set_monitor(dw::scan_monitor *monitor)
+    {
+        walker_.set_monitor(monitor);
+        native_walker_.set_monitor(monitor);
+    }
+
+    // `die` is a cppdwarf::die or a cppdwarf::native::die, returns false if the walk was cancelled
+    template <typename Die>
+    bool parse(const Die &die, const std::vector<std::string> &src_files)
+    {
+        scope_visitor visitor{*this, src_files};
+        if constexpr (std::is_same_v<Die, dw::native::die>) {
+            return native_walker_.walk(die, visitor);
+        }
+        else {
+            return walker_.walk(die, visitor);
         }
-        case dw::tag::class_type:
-        case dw::tag::structure_type:
-        case dw::tag::union_type:
-        case dw::tag::enumeration_type: {
-            std::string decl_file;
-            int decl_line = 0;
-            if (auto it = child.find(dw::attribute_t::decl_file); it != child.attributes().end()) {
-                decl_file = src_files.at(it->get<int>()); // Map file index to file name
+    }
+
+    // writes {"<file>": [{"line": <line>, "name": "<name>"}, ...], ...} with files sorted by path
+    void write_json(std::ostream &os) const
+    {
+        auto records = records_.records();
+        std::sort(records.begin(), records.end(), [&](const type_record &lhs, const type_record &rhs) {
+            if (lhs.file != rhs.file) {
+                return strings_[lhs.file] < strings_[rhs.file];
             }
-            if (auto it = child.find(dw::attribute_t::decl_line); it != child.attributes().end()) {
-                decl_line = it->get<int>();
+            if (lhs.line != rhs.line) {
+                return lhs.line < rhs.line;
             }
+            return strings_[lhs.name] < strings_[rhs.name];
+        });
 
-            if (!name.empty() && !decl_file.empty() && decl_line > 0) {
-                parents.push_back(name);
-                result[decl_file].insert(nlohmann::json{
-                    {"line", decl_line},
-                    {"name", join(parents, "::")},
-                });
-                parse(child, parents, src_files); // Recursive parsing of children
-                parents.pop_back();
+        os << "{";
+        for (std::size_t i = 0; i < records.size(); ++i) {
+            const auto &record = records[i];
+            const bool first_in_file = i == 0 || records[i - 1].file != record.file;
+            if (first_in_file) {
+                os << (i == 0 ? "\n    " : "\n    ],\n    ");
+                write_json_string(os, strings_[record.file]);
+                os << ": [\n        {\n";
             }
-            break;
+            else {
+                os << ",\n        {\n";
+            }
+            os << "            \"line\": " << record.line << ",\n            \"name\": ";
+            write_json_string(os, strings_[record.name]);
+            os << "\n        }";
         }
-        default: {
-            break;
+        os << (records.empty() ? "}" : "\n    ]\n}");
+    }
+
+    // returns false if the record was already present
+    bool add(const std::string &file, const std::string &name, std::uint32_t line)
+    {
+        if (!records_.insert({strings_.intern(file), strings_.intern(name), line})) {
+            return false;
+        }
+        if (on_new_) {
+            on_new_(file, name, line);
+        }
+        return true;
+    }
+
+    // adds the records of a collector that used its own string table
+    void merge(const type_collector &other)
+    {
+        for (const auto &record : other.records_.records()) {
+            add(other.strings_[record.file], other.strings_[record.name], record.line);
         }
+    }
+
+    [[nodiscard]] std::size_t size() const
+    {
+        return records_.size();
+    }
+
+private:
+    // Builds the qualified name of every type while walking: `parents` is the name of the current scope, and
+    // `lengths[depth]` its length before the DIE at that depth appended its own name.
+    struct scope_visitor {
+        type_collector &collector;
+        const std::vector<std::string> &src_files;
+        std::string parents;
+        std::vector<std::size_t> lengths;
+
+        template <typename Die>
+        dw::walk_result enter(const Die &die, const dw::walk_context &context)
+        {
+            lengths.resize(context.depth);
+            lengths.push_back(parents.size());
+
+            auto [name_attr, file_attr, line_attr] =
+                die.template read<dw::attribute_t::name, dw::attribute_t::decl_file, dw::attribute_t::decl_line>();
+            std::string name = name_attr ? std::move(*name_attr) : std::string();
+
+            if (die.tag() == dw::tag::namespace_) {
+                if (name.empty()) {
+                    // Assign a special name for anonymous namespaces
+                    name = "__anonymous_namespace__";
+                }
+                push(name);
+                return dw::walk_result::continue_;
+            }
+
+            // class, struct, union or enum
+            const std::string *decl_file = file_attr ? &src_files.at(*file_attr) : nullptr;
+            const auto decl_line = line_attr.value_or(0);
+            if (name.empty() || !decl_file || decl_file->empty() || decl_line <= 0) {
+                return dw::walk_result::skip;
+            }
+            push(name);
+            collector.add(*decl_file, parents, static_cast<std::uint32_t>(decl_line));
+            return dw::walk_result::continue_; // nested types
+        }
+
+        template <typename Die>
+        void leave(const Die & /*die*/, const dw::walk_context &context)
+        {
+            parents.resize(lengths[context.depth]);
+        }
+
+        // appends "::name" to the qualified name of the parents
+        void push(const std::string &name)
+        {
+            if (!parents.empty()) {
+                parents += "::";
+            }
+            parents += name;
+        }
+    };
+
+    // Functions, lexical blocks, variables etc. are skipped along with their subtrees without being materialized
+    static dw::tag_set scopes()
+    {
+        return {dw::tag::namespace_, dw::tag::class_type, dw::tag::structure_type, dw::tag::union_type,
+                dw::tag::enumeration_type};
+    }
+
+    dw::walker walker_{scopes()};
+    dw::native::walker native_walker_{scopes()};
+    string_table strings_;
+    record_set records_;
+    callback on_new_;
+};
+
+// Scans every `jobs`-th type unit starting at `worker` and the worker's share of the CUs, a range of consecutive CUs
+// holding about 1/jobs of .debug_info, so workers with their own handle never overlap. With a native reader, the CUs
+// are decoded from its sections and only their line tables are read through `debug`. The CUs done are reported to
+// `monitor`, shared by all workers, and the scan stops early once it is cancelled.
+void scan(const dw::debug &debug, const dw::native::reader *native, unsigned worker, unsigned jobs,
+          type_collector &collector, dw::scan_monitor &monitor)
+{
+    const auto &units = debug.units();
+    monitor.set_totals(units.size(), units.bytes());
+    collector.set_monitor(&monitor);
+
+    // scan runs on each worker thread, so every worker has its own arena, reset between units
+    dw::arena arena;
+    std::size_t index = 0;
+    for (const auto &tu : debug.type_units()) {
+        if (index++ % jobs != worker) {
+            continue;
+        }
+        arena.reset();
+        dw::arena::scope use_arena(arena);
+        auto &tu_die = tu.die();
+        auto src_files = tu_die.src_files();
+        if (tu.version() < 5) {
+            src_files.insert(src_files.begin(), "placeholder_do_not_use");
+        }
+        if (!collector.parse(tu_die, src_files)) {
+            return;
+        }
+    }
+
+    index = 0;
+    if (native) {
+        for (const auto &unit : *native) {
+            if (index++ % jobs != worker) {
+                continue;
+            }
+            auto src_files = unit.src_files(debug);
+            if (unit.version() < 5) {
+                src_files.insert(src_files.begin(), "placeholder_do_not_use");
+            }
+            if (!collector.parse(unit.die(), src_files) || !monitor.unit_done(unit.length())) {
+                return;
+            }
+        }
+        return;
+    }
+    // the CUs of other workers are not even visited
+    const auto bounds = units.partition(jobs);
+    for (auto i = bounds[worker]; i < bounds[worker + 1]; ++i) {
+        arena.reset();
+        dw::arena::scope use_arena(arena);
+        const auto cu = debug.unit(i);
+        auto &cu_die = cu.die();
+        spdlog::debug("{}", cu_die.attributes().at(dw::attribute_t::name)->get<std::string>());
+        auto src_files = cu_die.src_files();
+        if (cu.version() < 5) {
+            src_files.insert(src_files.begin(), "placeholder_do_not_use");
+        }
+        if (!collector.parse(cu_die, src_files) || !monitor.unit_done(units[i].length)) {
+            return;
+        }
+    }
+}
+
+// cancelled by the first SIGINT, which lets the workers stop between DIEs; a second one terminates as usual
+dw::cancellation_token interrupted;
+
+void on_interrupt(int /*signal*/)
+{
+    interrupted.cancel();
+    std::signal(SIGINT, SIG_DFL);
+}
+
+void log_progress(const dw::scan_progress &progress)
+{
+    constexpr double mib = 1024.0 * 1024.0;
+    spdlog::info("{:5.1f}% ({}/{} CUs, {:.1f}/{:.1f} MiB, {} DIEs)", progress.fraction() * 100, progress.units_done,
+                 progress.units_total, static_cast<double>(progress.bytes_done) / mib,
+                 static_cast<double>(progress.bytes_total) / mib, progress.dies);
+}
+
+void log_perf_stats(const dw::perf_stats &stats)
+{
+    if (!stats.enabled) {
+        spdlog::info("cppdwarf performance counters are not available, build with -DCPPDWARF_STATS=ON");
+        return;
+    }
+    spdlog::info("cppdwarf: {} DIEs, {} attribute lists, {} references resolved, {} strings copied", stats.dies,
+                 stats.attribute_lists, stats.reference_resolutions, stats.string_copies);
+    for (std::size_t i = 0; i < dw::libdwarf_call_count; ++i) {
+        const auto call = static_cast<dw::libdwarf_call>(i);
+        if (stats.call_count(call) == 0) {
+            continue;
+        }
+        if (dw::is_timed(call)) {
+            spdlog::info("  {:<24} {:>10} calls {:>10.2f} ms", dw::to_string(call), stats.call_count(call),
+                         std::chrono::duration<double, std::milli>(stats.time_in(call)).count());
+        }
+        else {
+            spdlog::info("  {:<24} {:>10} calls", dw::to_string(call), stats.call_count(call));
         }
     }
 }
 
+void log_heap_usage(const dw::heap_usage &heap)
+{
+    if (!heap.enabled) {
+        return;
+    }
+    for (std::size_t i = 0; i < dw::memory_category_count; ++i) {
+        spdlog::info("  {:<16} {:>12} bytes held {:>12} at peak {:>10} allocations",
+                     dw::to_string(static_cast<dw::memory_category>(i)), heap.bytes[i], heap.peak_bytes[i],
+                     heap.allocations[i]);
+    }
+}
+
 int main(int argc, char *argv[])
 {
     argparse::ArgumentParser parser("cpp2dwarf");
     parser.add_argument("path").help("path to a DWARF debug symbol file");
+    parser.add_argument("-o", "--output").help("path of the output file").default_value(std::string("output.json"));
+    parser.add_argument("--ndjson")
+        .help("write one JSON object per line ({\"file\", \"line\", \"name\"}) as types are found")
+        .flag();
+    parser.add_argument("-j", "--jobs")
+        .help("number of worker threads, each with its own handle on the file (0: one per hardware thread)")
+        .default_value(1)
+        .scan<'i', int>();
+    parser.add_argument("--native")
+        .help("decode .debug_info directly instead of through libdwarf (uncompressed little-endian DWARF only)")
+        .flag();
+    parser.add_argument("--stats").help("print cppdwarf performance counters").flag();
+    parser.add_argument("--progress").help("log how much of .debug_info was scanned every second").flag();
     try {
         parser.parse_args(argc, argv);
     }
@@ -89,44 +462,107 @@ int main(int argc, char *argv[])
     }
 
     auto path = parser.get<std::string>("path");
-    auto debug = dw::debug(path); // Load the DWARF debug symbols from the file
+    auto output_path = parser.get<std::string>("--output");
+    auto ndjson = parser.get<bool>("--ndjson");
+    auto jobs = static_cast<unsigned>(std::max(0, parser.get<int>("--jobs")));
+    auto native = parser.get<bool>("--native");
+    if (jobs == 0) {
+        jobs = std::max(1U, std::thread::hardware_concurrency());
+    }
 
-    spdlog::info("Parsing type units");
-    for (const auto &tu : debug.type_units()) {
-        auto &tu_die = tu.die();
-        std::vector<std::string> parents;
-        auto src_files = tu_die.src_files();
-        if (tu.version() < 5) {
-            src_files.insert(src_files.begin(), "placeholder_do_not_use");
-        }
-        parse(tu_die, parents, src_files);
+    std::ofstream output_file(output_path);
+    if (!output_file.is_open()) {
+        spdlog::error("Failed to open '{}' for writing", output_path);
+        return 1;
     }
 
-    spdlog::info("Parsing compilation units");
-    for (const auto &cu : debug) {
-        auto &cu_die = cu.die();
-        std::string die_name = cu_die.find(dw::attribute_t::name)->get<std::string>();
-        spdlog::info("{}", die_name);
-        std::vector<std::string> parents;
-        auto src_files = cu_die.src_files();
-        if (cu.version() < 5) {
-            src_files.insert(src_files.begin(), "placeholder_do_not_use");
-        }
-        parse(cu_die, parents, src_files);
+    type_collector::callback write_record;
+    if (ndjson) {
+        write_record = [&](const std::string &file, const std::string &name, std::uint32_t line) {
+            write_ndjson_record(output_file, file, name, line);
+        };
     }
+    type_collector collector(write_record);
 
-    nlohmann::json json;
-    for (const auto &[key, value] : result) {
-        json[key] = value;
+    // The native reader only reads from the section bytes it loaded, so all workers share one
+    std::unique_ptr<dw::debug> native_debug;
+    std::unique_ptr<dw::native::reader> native_reader;
+    if (native) {
+        native_debug = std::make_unique<dw::debug>(path);
+        native_reader = std::make_unique<dw::native::reader>(*native_debug);
     }
-    std::ofstream output_file("output.json");
-    if (output_file.is_open()) {
-        output_file << json.dump(4);
-        output_file.close();
-        spdlog::info("JSON result successfully written to 'output.json'");
+
+    dw::scan_monitor monitor(parser.get<bool>("--progress") ? dw::scan_monitor::sink(log_progress) : nullptr,
+                             interrupted, std::chrono::seconds(1));
+    std::signal(SIGINT, on_interrupt);
+
+    spdlog::info("Parsing type units and compilation units with {} worker(s)", jobs);
+    if (jobs == 1) {
+        // Load the DWARF debug symbols from the file
+        scan(dw::debug(path), native_reader.get(), 0, 1, collector, monitor);
     }
     else {
-        spdlog::error("Failed to open file for writing JSON result");
+        // Every worker collects into its own table. In NDJSON mode the records are streamed through the shared
+        // collector as they are found, which also drops the ones another worker has already written.
+        std::mutex mutex;
+        std::vector<type_collector> locals;
+        locals.reserve(jobs);
+        for (unsigned i = 0; i < jobs; ++i) {
+            type_collector::callback forward;
+            if (ndjson) {
+                forward = [&](const std::string &file, const std::string &name, std::uint32_t line) {
+                    const std::lock_guard lock(mutex);
+                    collector.add(file, name, line);
+                };
+            }
+            locals.emplace_back(forward);
+        }
+
+        std::exception_ptr error;
+        std::vector<std::thread> workers;
+        for (unsigned i = 0; i < jobs; ++i) {
+            workers.emplace_back([&, i]() {
+                try {
+                    // libdwarf handles are not thread-safe, so every worker opens the file itself
+                    scan(dw::debug(path), native_reader.get(), i, jobs, locals[i], monitor);
+                }
+                catch (...) {
+                    const std::lock_guard lock(mutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+            });
+        }
+        for (auto &worker : workers) {
+            worker.join();
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+
+        if (!ndjson) {
+            for (const auto &local : locals) {
+                collector.merge(local);
+            }
+        }
+    }
+    monitor.finish();
+    if (monitor.cancelled()) {
+        const auto progress = monitor.progress();
+        spdlog::warn("Interrupted after {} of {} CUs, '{}' is incomplete", progress.units_done, progress.units_total,
+                     output_path);
+        return 130;
+    }
+
+    if (!ndjson) {
+        collector.write_json(output_file);
+    }
+    output_file.close();
+    spdlog::info("{} types successfully written to '{}'", collector.size(), output_path);
+    if (parser.get<bool>("--stats")) {
+        log_perf_stats(dw::debug::stats());
+        log_heap_usage(dw::debug::heap());
     }
 
     return 0;
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "symbolizerd/binary_index.h"
+#include "symbolizerd/protocol.h"
+
+// The binaries symbolizerd keeps open, by path, and the requests for them.
+//
+// Concurrent requests for the same binary are coalesced. While one thread runs a batch for a binary, requests that
+// arrive for it queue up. The next thread to take over runs all of them as one batch: one sorted pass over the
+// indexes for all their addresses.
+//
+// Binaries no request is using are evicted, least recently used first, once the memory of all open binaries exceeds
+// the budget. A binary whose file changed on disk is reopened by the next request.
+class binary_cache {
+public:
+    struct stats {
+        std::size_t binaries = 0; // open now
+        std::size_t memory = 0;   // estimated, see binary_index::memory_usage()
+        std::size_t opened = 0;
+        std::size_t evicted = 0;
+        std::size_t requests = 0;
+        std::size_t batches = 0; // requests - batches were coalesced into a batch run by another thread
+    };
+
+    explicit binary_cache(std::size_t memory_budget) : memory_budget_(memory_budget) {}
+
+    // thread-safe, blocks until the request's batch is done
+    protocol::response symbolize(const protocol::request &request);
+
+    [[nodiscard]] stats get_stats() const;
+
+private:
+    // a request waiting for its batch
+    struct pending {
+        const protocol::request *request;
+        protocol::response response;
+        bool done = false;
+    };
+
+    struct binary {
+        std::string path;
+        std::filesystem::file_time_type modified;
+        std::uintmax_t size = 0;
+
+        // guarded by mutex
+        std::mutex mutex;
+        std::condition_variable batch_done;
+        std::vector<pending *> queue;
+        bool running = false; // a thread is running a batch
+
+        // only touched by the thread running a batch
+        std::unique_ptr<binary_index> index;
+        std::atomic<std::size_t> memory{0}; // as of the last batch
+
+        // guarded by the cache's mutex
+        std::size_t users = 0;
+        std::size_t accounted_memory = 0; // what memory_ holds for this binary
+        bool cached = true;
+        bool failed = false; // dropped once no request uses it, the next request opens it again
+        std::list<std::shared_ptr<binary>>::iterator lru_position;
+    };
+
+    // Finds the binary or adds it, to be opened by its first batch. Returns nullptr, with `error` set, if the file
+    // does not exist.
+    std::shared_ptr<binary> acquire(const std::string &path, std::string &error);
+    void release(const std::shared_ptr<binary> &b);
+    void run_batch(binary &b, const std::vector<pending *> &batch);
+    // Called by the thread running a batch. fail_binary() closes the binary's index and marks it failed,
+    // abort_batch() also fails every request of a batch run_batch() threw out of.
+    void abort_batch(binary &b, const std::vector<pending *> &batch) noexcept;
+    void fail_binary(binary &b) noexcept;
+    // The functions below are called with mutex_ held. The binaries they take out of the cache are moved to `removed`,
+    // to be destroyed after the lock is released: closing a binary takes a while.
+    void evict(std::vector<std::shared_ptr<binary>> &removed);
+    void remove(binary &b, std::vector<std::shared_ptr<binary>> &removed);
+
+    mutable std::mutex mutex_;
+    std::size_t memory_budget_;
+    std::size_t memory_ = 0;
+    std::list<std::shared_ptr<binary>> lru_; // most recently used first
+    std::unordered_map<std::string, std::shared_ptr<binary>> binaries_;
+    stats stats_;
+};
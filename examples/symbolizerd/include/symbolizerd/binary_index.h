@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <cppdwarf/cppdwarf.hpp>
+
+namespace dw = cppdwarf;
+
+// The debug information of one binary, with the indexes that map addresses to locations built on first use: the line
+// index from the line tables of all CUs, the function index from the address ranges of their subprogram DIEs. A
+// lookup for a batch of addresses sorts them and walks both indexes once.
+//
+// Not thread-safe, like the libdwarf handle it keeps open: binary_cache runs one batch of a binary at a time.
+class binary_index {
+public:
+    // string views into the index, valid as long as it lives
+    struct location {
+        std::string_view function;
+        std::string_view file;
+        std::uint32_t line = 0;
+        std::uint32_t column = 0;
+    };
+
+    // throws cppdwarf::init_error if the file cannot be opened or has no debug information
+    explicit binary_index(const std::string &path);
+
+    // Looks up every address, in any order, building the indexes `flags` (protocol::flags) asks for first. Returns one
+    // location per address, in the same order.
+    std::vector<location> symbolize(const std::vector<std::uint64_t> &addresses, std::uint16_t flags);
+
+    // An estimate of the memory the binary holds on to: its indexes and what the debug object holds, see
+    // cppdwarf::debug::memory()
+    [[nodiscard]] std::size_t memory_usage() const;
+
+private:
+    // a row of the merged line tables; a row with file == end_of_sequence ends the code of the row before it
+    struct line_entry {
+        std::uint64_t address;
+        std::uint32_t file;
+        std::uint32_t line;
+        std::uint32_t column;
+    };
+
+    struct function_entry {
+        std::uint64_t low;
+        std::uint64_t high;
+        std::uint32_t name;
+    };
+
+    static constexpr std::uint32_t end_of_sequence = 0xffffffff;
+
+    void build_line_index();
+    void build_function_index();
+    // DW_AT_linkage_name or DW_AT_name, taken from the declaration or abstract instance if the DIE has neither
+    std::string function_name(const dw::compilation_unit &cu, const dw::die &die, int depth = 0) const;
+    std::uint32_t intern(std::string_view str);
+
+    dw::debug debug_;
+    bool lines_built_ = false;
+    bool functions_built_ = false;
+    std::vector<line_entry> lines_;         // sorted by address
+    std::vector<function_entry> functions_; // sorted by low address
+    std::deque<std::string> strings_;       // file and function names, never relocated
+    std::unordered_map<std::string_view, std::uint32_t> string_ids_;
+    std::size_t string_bytes_ = 0;
+};
@@ -0,0 +1,90 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// The symbolizerd wire format. Every message is a frame: a u32 payload size, then the payload. Integers are in host
+// byte order, as the socket is local. A connection carries any number of request and response pairs, one at a time.
+//
+//   request:  u16 version, u16 flags, u32 path size, u32 address count, path, u64 address[address count]
+//   response: u16 version, u16 status, u32 location count, u32 string table size,
+//             {u32 function, u32 file, u32 line, u32 column}[location count], string table
+//
+// Responses have one location per requested address, in the same order. Strings are offsets of NUL-terminated strings
+// in the string table, no_string when unknown; line and column are 0 when unknown. Unless the status is ok, there are
+// no locations and the string table holds an error message.
+namespace protocol {
+
+inline constexpr std::uint16_t version = 1;
+inline constexpr std::uint32_t no_string = 0xffffffff;
+inline constexpr std::uint32_t max_payload_size = 64U << 20;
+inline constexpr std::uint32_t max_path_size = 4096;
+
+// what a request asks for
+enum flags : std::uint16_t {
+    lines = 1,     // source file, line and column of each address
+    functions = 2, // name of the function containing each address, its linkage name if it has one
+};
+
+enum class status : std::uint16_t {
+    ok,
+    bad_request,    // malformed payload or unsupported version, the connection is closed after the response
+    open_failed,    // the binary cannot be opened or has no debug information
+    internal_error, // reading the debug information failed
+};
+
+const char *to_string(status s);
+
+// a malformed frame or payload
+class error : public std::runtime_error {
+public:
+    using std::runtime_error::runtime_error;
+};
+
+struct request {
+    std::uint16_t flags = lines | functions;
+    std::string path;
+    std::vector<std::uint64_t> addresses;
+};
+
+struct location {
+    std::uint32_t function = no_string;
+    std::uint32_t file = no_string;
+    std::uint32_t line = 0;
+    std::uint32_t column = 0;
+};
+
+struct response {
+    status code = status::ok;
+    std::vector<location> locations;
+    std::string strings;
+
+    // appends a string to the string table and returns its offset
+    std::uint32_t add_string(std::string_view str);
+    // the string at `offset` in the string table, empty for no_string
+    [[nodiscard]] std::string_view string(std::uint32_t offset) const;
+
+    static response failure(status code, std::string_view message);
+};
+
+// the whole frame, size included
+std::vector<std::uint8_t> encode(const request &r);
+std::vector<std::uint8_t> encode(const response &r);
+
+// decode a frame's payload, throw protocol::error if it is malformed
+request decode_request(const std::vector<std::uint8_t> &payload);
+response decode_response(const std::vector<std::uint8_t> &payload);
+
+// Reads the next frame's payload. Returns std::nullopt if the peer closed the connection between frames, throws
+// protocol::error for an oversized frame and std::system_error on socket errors.
+std::optional<std::vector<std::uint8_t>> read_frame(int fd);
+void write_frame(int fd, const std::vector<std::uint8_t> &frame);
+
+// A socket connected to the daemon listening on `socket_path`, throws std::system_error
+int connect(const std::string &socket_path);
+
+} // namespace protocol
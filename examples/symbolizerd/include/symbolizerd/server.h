@@ -0,0 +1,46 @@
+#pragma once
+
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "symbolizerd/binary_cache.h"
+
+// Accepts connections on a Unix domain socket and serves each one on its own thread, see protocol.h for the format.
+class server {
+public:
+    // binds and listens on `socket_path`, replacing a stale socket file; throws std::system_error
+    server(std::string socket_path, binary_cache &cache);
+    ~server();
+
+    server(const server &) = delete;
+    server &operator=(const server &) = delete;
+
+    // Serves until stop() is called, then closes all connections and waits for their threads
+    void run();
+    // Only sets a flag run() checks every poll interval, so it may be called from a signal handler
+    void stop()
+    {
+        stopping_ = true;
+    }
+
+private:
+    struct connection {
+        int fd;
+        std::thread thread;
+        std::atomic<bool> done{false};
+    };
+
+    void serve(connection &c);
+    // joins the threads of the connections that are done
+    void reap();
+
+    std::string socket_path_;
+    binary_cache &cache_;
+    int listen_fd_ = -1;
+    std::atomic<bool> stopping_{false};
+    std::mutex connections_mutex_;
+    std::list<connection> connections_;
+};
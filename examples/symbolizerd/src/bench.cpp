@@ -0,0 +1,225 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include <argparse/argparse.hpp>
+#include <cppdwarf/cppdwarf.hpp>
+#include <spdlog/spdlog.h>
+
+#include "symbolizerd/protocol.h"
+
+namespace dw = cppdwarf;
+using clock_type = std::chrono::steady_clock;
+
+// Draws addresses from the code ranges of a binary's CUs, every address equally likely
+class address_sampler {
+public:
+    explicit address_sampler(const std::string &path)
+    {
+        dw::debug debug(path);
+        for (const auto &cu : debug) {
+            const auto &cu_die = cu.die();
+            for (const auto &range : cu_die.address_ranges(cu_die.try_low_pc().value_or(0))) {
+                ranges_.push_back(range);
+                total_ += range.high - range.low;
+                ends_.push_back(total_);
+            }
+        }
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return total_ == 0;
+    }
+
+    template <typename Rng>
+    std::uint64_t operator()(Rng &rng) const
+    {
+        const auto offset = std::uniform_int_distribution<std::uint64_t>(0, total_ - 1)(rng);
+        const auto i = static_cast<std::size_t>(std::upper_bound(ends_.begin(), ends_.end(), offset) - ends_.begin());
+        return ranges_[i].high - (ends_[i] - offset);
+    }
+
+private:
+    std::vector<dw::address_range> ranges_;
+    std::vector<std::uint64_t> ends_; // running total of the range sizes
+    std::uint64_t total_ = 0;
+};
+
+// one request and response on an open connection
+protocol::response round_trip(int fd, const protocol::request &request)
+{
+    protocol::write_frame(fd, protocol::encode(request));
+    auto payload = protocol::read_frame(fd);
+    if (!payload) {
+        throw protocol::error("the daemon closed the connection");
+    }
+    return protocol::decode_response(*payload);
+}
+
+void check(const protocol::response &response)
+{
+    if (response.code != protocol::status::ok) {
+        throw std::runtime_error(std::string(protocol::to_string(response.code)) + ": " +
+                                 std::string(response.string(0)));
+    }
+}
+
+int query(const std::string &socket_path, protocol::request request)
+{
+    const int fd = protocol::connect(socket_path);
+    const auto response = round_trip(fd, request);
+    ::close(fd);
+    check(response);
+    for (std::size_t i = 0; i < request.addresses.size(); ++i) {
+        const auto &loc = response.locations[i];
+        const auto function = response.string(loc.function);
+        const auto file = response.string(loc.file);
+        std::cout << fmt::format("{:#x} {} {}:{}:{}\n", request.addresses[i], function.empty() ? "??" : function,
+                                 file.empty() ? "??" : file, loc.line, loc.column);
+    }
+    return 0;
+}
+
+double percentile(const std::vector<double> &sorted, double p)
+{
+    const auto i = static_cast<std::size_t>(p / 100 * static_cast<double>(sorted.size() - 1) + 0.5);
+    return sorted[std::min(i, sorted.size() - 1)];
+}
+
+int main(int argc, char *argv[])
+{
+    argparse::ArgumentParser parser("symbolizerd-bench");
+    parser.add_argument("path").help("binary to symbolize addresses in, sampled from its CUs' address ranges");
+    parser.add_argument("--socket")
+        .help("path of the daemon's Unix domain socket")
+        .default_value(std::string("/tmp/symbolizerd.sock"));
+    parser.add_argument("-c", "--clients").help("concurrent connections").default_value(8).scan<'i', int>();
+    parser.add_argument("-n", "--requests").help("requests per client").default_value(1000).scan<'i', int>();
+    parser.add_argument("-b", "--batch").help("addresses per request").default_value(64).scan<'i', int>();
+    parser.add_argument("--seed").help("seed of the address sampler").default_value(1).scan<'i', int>();
+    parser.add_argument("--query")
+        .help("symbolize these hexadecimal addresses and print the results instead of benchmarking")
+        .nargs(argparse::nargs_pattern::at_least_one);
+    try {
+        parser.parse_args(argc, argv);
+    }
+    catch (std::exception &err) {
+        std::cerr << err.what() << std::endl;
+        std::cerr << parser;
+        return 1;
+    }
+
+    const auto socket_path = parser.get<std::string>("--socket");
+    protocol::request request;
+    request.path = parser.get<std::string>("path");
+    try {
+        if (parser.is_used("--query")) {
+            for (const auto &address : parser.get<std::vector<std::string>>("--query")) {
+                request.addresses.push_back(std::stoull(address, nullptr, 16));
+            }
+            return query(socket_path, request);
+        }
+
+        const auto clients = static_cast<unsigned>(std::max(1, parser.get<int>("--clients")));
+        const auto requests = static_cast<std::size_t>(std::max(1, parser.get<int>("--requests")));
+        const auto batch = static_cast<std::size_t>(std::max(1, parser.get<int>("--batch")));
+        const address_sampler sampler(request.path);
+        if (sampler.empty()) {
+            spdlog::error("'{}' has no CU with address ranges", request.path);
+            return 1;
+        }
+
+        // the first request opens the binary and builds its indexes
+        std::mt19937_64 rng(static_cast<std::uint64_t>(parser.get<int>("--seed")));
+        for (std::size_t i = 0; i < batch; ++i) {
+            request.addresses.push_back(sampler(rng));
+        }
+        {
+            const int fd = protocol::connect(socket_path);
+            const auto start = clock_type::now();
+            const auto response = round_trip(fd, request);
+            const auto cold = std::chrono::duration<double, std::milli>(clock_type::now() - start).count();
+            ::close(fd);
+            check(response);
+            spdlog::info("Cold request: {:.2f} ms", cold);
+        }
+
+        std::mutex mutex;
+        std::vector<double> latencies;
+        std::size_t symbolized = 0;
+        std::exception_ptr error;
+        std::vector<std::thread> threads;
+        const auto seed = rng();
+        const auto start = clock_type::now();
+        for (unsigned c = 0; c < clients; ++c) {
+            threads.emplace_back([&, c]() {
+                std::vector<double> local_latencies;
+                std::size_t local_symbolized = 0;
+                try {
+                    std::mt19937_64 local_rng(seed + c);
+                    const int fd = protocol::connect(socket_path);
+                    auto r = request;
+                    for (std::size_t i = 0; i < requests; ++i) {
+                        for (auto &address : r.addresses) {
+                            address = sampler(local_rng);
+                        }
+                        const auto sent = clock_type::now();
+                        const auto response = round_trip(fd, r);
+                        local_latencies.push_back(
+                            std::chrono::duration<double, std::milli>(clock_type::now() - sent).count());
+                        check(response);
+                        local_symbolized += static_cast<std::size_t>(
+                            std::count_if(response.locations.begin(), response.locations.end(),
+                                          [](const auto &loc) { return loc.function != protocol::no_string; }));
+                    }
+                    ::close(fd);
+                }
+                catch (...) {
+                    const std::lock_guard lock(mutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                }
+                const std::lock_guard lock(mutex);
+                latencies.insert(latencies.end(), local_latencies.begin(), local_latencies.end());
+                symbolized += local_symbolized;
+            });
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        const auto elapsed = std::chrono::duration<double>(clock_type::now() - start).count();
+        if (error) {
+            std::rethrow_exception(error);
+        }
+
+        std::sort(latencies.begin(), latencies.end());
+        double sum = 0;
+        for (const auto latency : latencies) {
+            sum += latency;
+        }
+        const auto count = static_cast<double>(latencies.size());
+        spdlog::info("{} clients, {} requests of {} addresses in {:.2f} s", clients, latencies.size(), batch, elapsed);
+        spdlog::info("Latency (ms): p50 {:.3f}, p90 {:.3f}, p99 {:.3f}, p99.9 {:.3f}, max {:.3f}, mean {:.3f}",
+                     percentile(latencies, 50), percentile(latencies, 90), percentile(latencies, 99),
+                     percentile(latencies, 99.9), latencies.back(), sum / count);
+        spdlog::info("Throughput: {:.0f} requests/s, {:.0f} addresses/s, {:.1f}% with a function", count / elapsed,
+                     count * static_cast<double>(batch) / elapsed,
+                     100.0 * static_cast<double>(symbolized) / (count * static_cast<double>(batch)));
+    }
+    catch (const std::exception &err) {
+        spdlog::error("{}", err.what());
+        return 1;
+    }
+    return 0;
+}
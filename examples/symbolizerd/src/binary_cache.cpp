@@ -0,0 +1,267 @@
+#include "symbolizerd/binary_cache.h"
+
+#include <exception>
+#include <string_view>
+#include <utility>
+
+#include <spdlog/spdlog.h>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+// calls a function when the scope is left, by an exception too
+template <typename F>
+class scope_exit {
+public:
+    explicit scope_exit(F f) : f_(std::move(f)) {}
+    scope_exit(const scope_exit &) = delete;
+    scope_exit &operator=(const scope_exit &) = delete;
+
+    ~scope_exit()
+    {
+        f_();
+    }
+
+private:
+    F f_;
+};
+
+} // namespace
+
+protocol::response binary_cache::symbolize(const protocol::request &request)
+{
+    std::string error;
+    auto b = acquire(request.path, error);
+    if (!b) {
+        return protocol::response::failure(protocol::status::open_failed, error);
+    }
+
+    // the request stops using the binary however it ends
+    const scope_exit released([&]() { release(b); });
+    pending p{&request, {}};
+    {
+        std::unique_lock lock(b->mutex);
+        b->queue.push_back(&p);
+        // Whoever finds no batch running takes everything queued so far, its own request included, and runs it. The
+        // others wait, and one of them takes over if its request came too late for that batch.
+        while (!p.done) {
+            if (b->running) {
+                b->batch_done.wait(lock);
+                continue;
+            }
+            b->running = true;
+            const auto batch = std::exchange(b->queue, {});
+            lock.unlock();
+            // If run_batch() throws, the other requests of the batch fail instead of waiting forever, and the binary
+            // is not used again. Either way the next batch can start.
+            const auto exceptions = std::uncaught_exceptions();
+            const scope_exit finished([&]() {
+                if (std::uncaught_exceptions() > exceptions) {
+                    abort_batch(*b, batch);
+                }
+                lock.lock();
+                for (auto *q : batch) {
+                    q->done = true;
+                }
+                b->running = false;
+                b->batch_done.notify_all();
+            });
+            run_batch(*b, batch);
+        }
+    }
+    return std::move(p.response);
+}
+
+binary_cache::stats binary_cache::get_stats() const
+{
+    const std::lock_guard lock(mutex_);
+    auto s = stats_;
+    s.binaries = binaries_.size();
+    s.memory = memory_;
+    return s;
+}
+
+std::shared_ptr<binary_cache::binary> binary_cache::acquire(const std::string &path, std::string &error)
+{
+    std::error_code ec;
+    const auto modified = fs::last_write_time(path, ec);
+    const auto size = ec ? 0 : fs::file_size(path, ec);
+    if (ec) {
+        error = path + ": " + ec.message();
+        return nullptr;
+    }
+
+    std::vector<std::shared_ptr<binary>> removed;
+    const std::lock_guard lock(mutex_);
+    ++stats_.requests;
+    std::shared_ptr<binary> b;
+    if (auto it = binaries_.find(path); it != binaries_.end()) {
+        if (it->second->modified == modified && it->second->size == size) {
+            b = it->second;
+            lru_.splice(lru_.begin(), lru_, b->lru_position);
+        }
+        else {
+            // requests still using the old file finish with it
+            spdlog::info("{} changed, reopening it", path);
+            remove(*it->second, removed);
+        }
+    }
+    if (!b) {
+        b = std::make_shared<binary>();
+        b->path = path;
+        b->modified = modified;
+        b->size = size;
+        lru_.push_front(b);
+        b->lru_position = lru_.begin();
+        binaries_.emplace(path, b);
+    }
+    ++b->users;
+    return b;
+}
+
+void binary_cache::release(const std::shared_ptr<binary> &b)
+{
+    std::vector<std::shared_ptr<binary>> removed;
+    const std::lock_guard lock(mutex_);
+    --b->users;
+    if (!b->cached) {
+        return;
+    }
+    if (b->failed) {
+        remove(*b, removed);
+        return;
+    }
+    const auto memory = b->memory.load();
+    memory_ = memory_ - b->accounted_memory + memory;
+    b->accounted_memory = memory;
+    evict(removed);
+}
+
+void binary_cache::run_batch(binary &b, const std::vector<pending *> &batch)
+{
+    {
+        const std::lock_guard lock(mutex_);
+        ++stats_.batches;
+    }
+    auto fail = [&](protocol::status code, std::string_view message) {
+        for (auto *q : batch) {
+            q->response = protocol::response::failure(code, message);
+        }
+        fail_binary(b);
+    };
+
+    if (!b.index) {
+        try {
+            b.index = std::make_unique<binary_index>(b.path);
+        }
+        catch (const std::exception &err) {
+            spdlog::warn("cannot open {}: {}", b.path, err.what());
+            fail(protocol::status::open_failed, err.what());
+            return;
+        }
+        spdlog::info("opened {}", b.path);
+        const std::lock_guard lock(mutex_);
+        ++stats_.opened;
+    }
+
+    std::vector<std::uint64_t> addresses;
+    std::uint16_t flags = 0;
+    for (const auto *q : batch) {
+        flags |= q->request->flags;
+        addresses.insert(addresses.end(), q->request->addresses.begin(), q->request->addresses.end());
+    }
+    try {
+        const auto locations = b.index->symbolize(addresses, flags);
+        auto next = locations.begin();
+        for (auto *q : batch) {
+            // every response gets its own string table, with each string once
+            auto &response = q->response;
+            std::unordered_map<std::string_view, std::uint32_t> offsets;
+            auto add = [&](std::string_view str) {
+                if (str.empty()) {
+                    return protocol::no_string;
+                }
+                auto [it, inserted] = offsets.try_emplace(str, 0);
+                if (inserted) {
+                    it->second = response.add_string(str);
+                }
+                return it->second;
+            };
+
+            const auto wanted = q->request->flags;
+            response.locations.reserve(q->request->addresses.size());
+            for (std::size_t i = 0; i < q->request->addresses.size(); ++i, ++next) {
+                protocol::location out;
+                if (wanted & protocol::functions) {
+                    out.function = add(next->function);
+                }
+                if (wanted & protocol::lines) {
+                    out.file = add(next->file);
+                    out.line = next->line;
+                    out.column = next->column;
+                }
+                response.locations.push_back(out);
+            }
+        }
+        b.memory = b.index->memory_usage();
+    }
+    catch (const std::exception &err) {
+        // the handle may be left in the middle of a traversal, so the binary is not used again
+        spdlog::error("symbolizing in {} failed: {}", b.path, err.what());
+        fail(protocol::status::internal_error, err.what());
+    }
+}
+
+void binary_cache::abort_batch(binary &b, const std::vector<pending *> &batch) noexcept
+{
+    try {
+        for (auto *q : batch) {
+            q->response = protocol::response::failure(protocol::status::internal_error, "the batch was aborted");
+        }
+    }
+    catch (...) {
+    }
+    fail_binary(b);
+}
+
+void binary_cache::fail_binary(binary &b) noexcept
+{
+    // still the thread running the batch, so the index is ours to drop; what may be left in the middle of a traversal
+    // is never used again, and the binary's memory is freed now rather than once the last request releases it
+    b.index.reset();
+    b.memory = 0;
+    const std::lock_guard lock(mutex_);
+    b.failed = true;
+}
+
+void binary_cache::evict(std::vector<std::shared_ptr<binary>> &removed)
+{
+    auto it = lru_.end();
+    while (memory_ > memory_budget_ && it != lru_.begin()) {
+        --it;
+        auto &b = **it;
+        if (b.users > 0) {
+            continue;
+        }
+        spdlog::info("evicting {} ({:.1f} MiB)", b.path, static_cast<double>(b.accounted_memory) / (1024 * 1024));
+        ++stats_.evicted;
+        // remove() erases the binary's list node, `it` moves on to the next older one first
+        auto next = std::next(it);
+        remove(b, removed);
+        it = next;
+    }
+}
+
+void binary_cache::remove(binary &b, std::vector<std::shared_ptr<binary>> &removed)
+{
+    if (!b.cached) {
+        return;
+    }
+    b.cached = false;
+    memory_ -= b.accounted_memory;
+    b.accounted_memory = 0;
+    removed.push_back(std::move(*b.lru_position));
+    lru_.erase(b.lru_position);
+    binaries_.erase(b.path);
+}
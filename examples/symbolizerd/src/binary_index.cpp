@@ -0,0 +1,183 @@
+#include "symbolizerd/binary_index.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include <spdlog/spdlog.h>
+
+#include "symbolizerd/protocol.h"
+
+binary_index::binary_index(const std::string &path) : debug_(path) {}
+
+std::vector<binary_index::location> binary_index::symbolize(const std::vector<std::uint64_t> &addresses,
+                                                            std::uint16_t flags)
+{
+    const bool want_lines = (flags & protocol::lines) != 0;
+    const bool want_functions = (flags & protocol::functions) != 0;
+    if (want_lines && !lines_built_) {
+        build_line_index();
+    }
+    if (want_functions && !functions_built_) {
+        build_function_index();
+    }
+
+    // in address order, each index is searched from where the previous address was found
+    std::vector<std::uint32_t> order(addresses.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](auto lhs, auto rhs) { return addresses[lhs] < addresses[rhs]; });
+
+    std::vector<location> result(addresses.size());
+    auto line = lines_.begin();
+    auto function = functions_.begin();
+    for (const auto i : order) {
+        const auto address = addresses[i];
+        auto &loc = result[i];
+        if (want_lines) {
+            line = std::upper_bound(line, lines_.end(), address,
+                                    [](std::uint64_t value, const line_entry &e) { return value < e.address; });
+            if (line != lines_.begin() && (line - 1)->file != end_of_sequence) {
+                const auto &row = *(line - 1);
+                loc.file = strings_[row.file];
+                loc.line = row.line;
+                loc.column = row.column;
+            }
+        }
+        if (want_functions) {
+            function = std::upper_bound(function, functions_.end(), address,
+                                        [](std::uint64_t value, const function_entry &e) { return value < e.low; });
+            if (function != functions_.begin() && address < (function - 1)->high) {
+                loc.function = strings_[(function - 1)->name];
+            }
+        }
+    }
+    return result;
+}
+
+std::size_t binary_index::memory_usage() const
+{
+    // the node based string map costs about a node and a bucket per string on top of the strings themselves
+    constexpr std::size_t per_string = sizeof(std::string) + sizeof(std::string_view) + sizeof(std::uint32_t) +
+                                       3 * sizeof(void *);
+    return debug_.memory().total() + lines_.capacity() * sizeof(line_entry) +
+           functions_.capacity() * sizeof(function_entry) + string_bytes_ + strings_.size() * per_string;
+}
+
+void binary_index::build_line_index()
+{
+    const auto unknown_file = intern("");
+    dw::arena arena;
+    for (const auto &cu : debug_) {
+        arena.reset();
+        dw::arena::scope use_arena(arena);
+        const auto &cu_die = cu.die();
+        const auto rows = cu_die.line_table();
+        if (rows.empty()) {
+            continue;
+        }
+        auto files = cu_die.src_files();
+        if (cu.version() < 5) {
+            files.insert(files.begin(), ""); // file numbers start at 1
+        }
+        // the names are only interned for the files rows refer to
+        std::vector<std::uint32_t> file_ids(files.size(), end_of_sequence);
+        for (const auto &row : rows) {
+            if (row.end_sequence) {
+                lines_.push_back({row.address, end_of_sequence, 0, 0});
+                continue;
+            }
+            auto file = unknown_file;
+            if (row.file < files.size()) {
+                auto &id = file_ids[row.file];
+                if (id == end_of_sequence) {
+                    id = intern(files[row.file]);
+                }
+                file = id;
+            }
+            lines_.push_back({row.address, file, static_cast<std::uint32_t>(row.line),
+                              static_cast<std::uint32_t>(row.column)});
+        }
+    }
+    // Where one sequence ends at the address the next one starts, the end goes first so the lookup finds the start.
+    // Rows at the same address otherwise keep their order, the last one is found.
+    std::stable_sort(lines_.begin(), lines_.end(), [](const line_entry &lhs, const line_entry &rhs) {
+        if (lhs.address != rhs.address) {
+            return lhs.address < rhs.address;
+        }
+        return lhs.file == end_of_sequence && rhs.file != end_of_sequence;
+    });
+    lines_.shrink_to_fit();
+    lines_built_ = true;
+    spdlog::debug("{}: indexed {} line table rows", debug_.path(), lines_.size());
+}
+
+void binary_index::build_function_index()
+{
+    // functions are found at the top level of the CU and in namespaces and classes, not below other functions
+    struct visitor {
+        binary_index &index;
+        const dw::compilation_unit &cu;
+        Dwarf_Addr base;
+
+        dw::walk_result enter(const dw::die &die, const dw::walk_context & /*context*/)
+        {
+            if (die.tag() != dw::tag::subprogram) {
+                return dw::walk_result::continue_;
+            }
+            const auto ranges = die.address_ranges(base);
+            if (!ranges.empty()) {
+                const auto name = index.intern(index.function_name(cu, die));
+                for (const auto &range : ranges) {
+                    index.functions_.push_back({range.low, range.high, name});
+                }
+            }
+            return dw::walk_result::skip;
+        }
+    };
+
+    dw::walker walker(dw::tag_set{dw::tag::namespace_, dw::tag::class_type, dw::tag::structure_type,
+                                  dw::tag::union_type, dw::tag::subprogram});
+    dw::arena arena;
+    for (const auto &cu : debug_) {
+        arena.reset();
+        dw::arena::scope use_arena(arena);
+        visitor v{*this, cu, cu.die().try_low_pc().value_or(0)};
+        walker.walk(cu, v);
+    }
+    std::sort(functions_.begin(), functions_.end(),
+              [](const function_entry &lhs, const function_entry &rhs) { return lhs.low < rhs.low; });
+    functions_.shrink_to_fit();
+    functions_built_ = true;
+    spdlog::debug("{}: indexed {} function ranges", debug_.path(), functions_.size());
+}
+
+std::string binary_index::function_name(const dw::compilation_unit &cu, const dw::die &die, int depth) const
+{
+    auto [linkage_name, name, specification, abstract_origin] =
+        die.read<dw::attribute_t::linkage_name, dw::attribute_t::name, dw::attribute_t::specification,
+                 dw::attribute_t::abstract_origin>();
+    if (linkage_name) {
+        return std::move(*linkage_name);
+    }
+    if (name) {
+        return std::move(*name);
+    }
+    // a definition refers to its declaration, an out-of-line instance to its abstract instance; bounded in case the
+    // references form a cycle
+    const auto &target = specification ? specification : abstract_origin;
+    if (target && depth < 4) {
+        return function_name(cu, cu.die_at(*target), depth + 1);
+    }
+    return {};
+}
+
+std::uint32_t binary_index::intern(std::string_view str)
+{
+    if (auto it = string_ids_.find(str); it != string_ids_.end()) {
+        return it->second;
+    }
+    const auto id = static_cast<std::uint32_t>(strings_.size());
+    const auto &stored = strings_.emplace_back(str);
+    string_ids_.emplace(stored, id);
+    string_bytes_ += stored.capacity() + 1;
+    return id;
+}
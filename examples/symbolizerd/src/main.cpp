@@ -0,0 +1,71 @@
+#include <algorithm>
+#include <csignal>
+#include <exception>
+#include <iostream>
+#include <string>
+
+#include <argparse/argparse.hpp>
+#include <spdlog/spdlog.h>
+
+#include "symbolizerd/binary_cache.h"
+#include "symbolizerd/server.h"
+
+namespace {
+
+server *running_server = nullptr;
+
+void on_signal(int /*signal*/)
+{
+    if (running_server) {
+        running_server->stop();
+    }
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    argparse::ArgumentParser parser("symbolizerd");
+    parser.add_argument("--socket")
+        .help("path of the Unix domain socket to listen on")
+        .default_value(std::string("/tmp/symbolizerd.sock"));
+    parser.add_argument("--memory-budget")
+        .help("MiB the open binaries may use before the least recently used ones are closed")
+        .default_value(1024)
+        .scan<'i', int>();
+    parser.add_argument("-v", "--verbose").help("log every connection and index built").flag();
+    try {
+        parser.parse_args(argc, argv);
+    }
+    catch (std::exception &err) {
+        std::cerr << err.what() << std::endl;
+        std::cerr << parser;
+        return 1;
+    }
+    if (parser.get<bool>("--verbose")) {
+        spdlog::set_level(spdlog::level::debug);
+    }
+
+    const auto socket_path = parser.get<std::string>("--socket");
+    const auto memory_budget = static_cast<std::size_t>(std::max(0, parser.get<int>("--memory-budget"))) << 20;
+    binary_cache cache(memory_budget);
+    try {
+        server srv(socket_path, cache);
+        running_server = &srv;
+        std::signal(SIGINT, on_signal);
+        std::signal(SIGTERM, on_signal);
+
+        spdlog::info("Listening on '{}' with a {} MiB memory budget", socket_path, memory_budget >> 20);
+        srv.run();
+        running_server = nullptr;
+    }
+    catch (const std::exception &err) {
+        spdlog::error("{}", err.what());
+        return 1;
+    }
+
+    const auto stats = cache.get_stats();
+    spdlog::info("Served {} requests in {} batches, opened {} binaries, evicted {}", stats.requests, stats.batches,
+                 stats.opened, stats.evicted);
+    return 0;
+}
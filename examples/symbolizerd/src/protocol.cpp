@@ -0,0 +1,278 @@
+#include "symbolizerd/protocol.h"
+
+#include <cerrno>
+#include <cstring>
+#include <system_error>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace protocol {
+namespace {
+
+constexpr std::size_t request_header_size = 2 + 2 + 4 + 4;
+constexpr std::size_t response_header_size = 2 + 2 + 4 + 4;
+constexpr std::size_t location_size = 4 * 4;
+
+template <typename T>
+void put(std::vector<std::uint8_t> &out, T value)
+{
+    const auto pos = out.size();
+    out.resize(pos + sizeof(T));
+    std::memcpy(out.data() + pos, &value, sizeof(T));
+}
+
+// reads the fields of a payload in order, checking every read against its size
+class reader {
+public:
+    explicit reader(const std::vector<std::uint8_t> &payload) : data_(payload.data()), size_(payload.size()) {}
+
+    template <typename T>
+    T get()
+    {
+        T value;
+        std::memcpy(&value, take(sizeof(T)), sizeof(T));
+        return value;
+    }
+
+    const std::uint8_t *take(std::size_t n)
+    {
+        if (n > size_ - pos_) {
+            throw error("truncated payload");
+        }
+        const auto *p = data_ + pos_;
+        pos_ += n;
+        return p;
+    }
+
+    void expect_end() const
+    {
+        if (pos_ != size_) {
+            throw error("trailing bytes after the payload");
+        }
+    }
+
+private:
+    const std::uint8_t *data_;
+    std::size_t size_;
+    std::size_t pos_ = 0;
+};
+
+// frames are built with a placeholder size, filled in once the payload is complete
+std::vector<std::uint8_t> start_frame(std::size_t payload_size)
+{
+    std::vector<std::uint8_t> frame;
+    frame.reserve(4 + payload_size);
+    put<std::uint32_t>(frame, 0);
+    return frame;
+}
+
+void finish_frame(std::vector<std::uint8_t> &frame)
+{
+    const auto size = static_cast<std::uint32_t>(frame.size() - 4);
+    std::memcpy(frame.data(), &size, sizeof(size));
+}
+
+// false if the peer closed the connection before the first byte
+bool read_exact(int fd, void *buffer, std::size_t size)
+{
+    auto *p = static_cast<char *>(buffer);
+    std::size_t done = 0;
+    while (done < size) {
+        const auto n = ::read(fd, p + done, size - done);
+        if (n == 0) {
+            if (done == 0) {
+                return false;
+            }
+            throw error("connection closed in the middle of a frame");
+        }
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::system_error(errno, std::generic_category(), "read");
+        }
+        done += static_cast<std::size_t>(n);
+    }
+    return true;
+}
+
+} // namespace
+
+const char *to_string(status s)
+{
+    switch (s) {
+    case status::ok:
+        return "ok";
+    case status::bad_request:
+        return "bad request";
+    case status::open_failed:
+        return "open failed";
+    case status::internal_error:
+        return "internal error";
+    }
+    return "unknown status";
+}
+
+std::uint32_t response::add_string(std::string_view str)
+{
+    const auto offset = static_cast<std::uint32_t>(strings.size());
+    strings.append(str);
+    strings.push_back('\0');
+    return offset;
+}
+
+std::string_view response::string(std::uint32_t offset) const
+{
+    if (offset == no_string || offset >= strings.size()) {
+        return {};
+    }
+    return {strings.c_str() + offset};
+}
+
+response response::failure(status code, std::string_view message)
+{
+    response r;
+    r.code = code;
+    r.add_string(message);
+    return r;
+}
+
+std::vector<std::uint8_t> encode(const request &r)
+{
+    auto frame = start_frame(request_header_size + r.path.size() + r.addresses.size() * 8);
+    put(frame, version);
+    put(frame, r.flags);
+    put(frame, static_cast<std::uint32_t>(r.path.size()));
+    put(frame, static_cast<std::uint32_t>(r.addresses.size()));
+    frame.insert(frame.end(), r.path.begin(), r.path.end());
+    for (const auto address : r.addresses) {
+        put(frame, address);
+    }
+    finish_frame(frame);
+    return frame;
+}
+
+std::vector<std::uint8_t> encode(const response &r)
+{
+    auto frame = start_frame(response_header_size + r.locations.size() * location_size + r.strings.size());
+    put(frame, version);
+    put(frame, static_cast<std::uint16_t>(r.code));
+    put(frame, static_cast<std::uint32_t>(r.locations.size()));
+    put(frame, static_cast<std::uint32_t>(r.strings.size()));
+    for (const auto &l : r.locations) {
+        put(frame, l.function);
+        put(frame, l.file);
+        put(frame, l.line);
+        put(frame, l.column);
+    }
+    frame.insert(frame.end(), r.strings.begin(), r.strings.end());
+    finish_frame(frame);
+    return frame;
+}
+
+request decode_request(const std::vector<std::uint8_t> &payload)
+{
+    reader in(payload);
+    if (in.get<std::uint16_t>() != version) {
+        throw error("unsupported protocol version");
+    }
+    request r;
+    r.flags = in.get<std::uint16_t>();
+    const auto path_size = in.get<std::uint32_t>();
+    const auto count = in.get<std::uint32_t>();
+    if (path_size == 0 || path_size > max_path_size) {
+        throw error("invalid path size");
+    }
+    const auto *path = in.take(path_size);
+    r.path.assign(reinterpret_cast<const char *>(path), path_size);
+    if (count > (payload.size() - request_header_size - path_size) / 8) {
+        throw error("truncated payload");
+    }
+    r.addresses.resize(count);
+    std::memcpy(r.addresses.data(), in.take(std::size_t{count} * 8), std::size_t{count} * 8);
+    in.expect_end();
+    return r;
+}
+
+response decode_response(const std::vector<std::uint8_t> &payload)
+{
+    reader in(payload);
+    if (in.get<std::uint16_t>() != version) {
+        throw error("unsupported protocol version");
+    }
+    response r;
+    r.code = static_cast<status>(in.get<std::uint16_t>());
+    const auto count = in.get<std::uint32_t>();
+    const auto strings_size = in.get<std::uint32_t>();
+    if (count > (payload.size() - response_header_size) / location_size) {
+        throw error("truncated payload");
+    }
+    r.locations.resize(count);
+    for (auto &l : r.locations) {
+        l.function = in.get<std::uint32_t>();
+        l.file = in.get<std::uint32_t>();
+        l.line = in.get<std::uint32_t>();
+        l.column = in.get<std::uint32_t>();
+    }
+    const auto *strings = in.take(strings_size);
+    r.strings.assign(reinterpret_cast<const char *>(strings), strings_size);
+    in.expect_end();
+    return r;
+}
+
+std::optional<std::vector<std::uint8_t>> read_frame(int fd)
+{
+    std::uint32_t size = 0;
+    if (!read_exact(fd, &size, sizeof(size))) {
+        return std::nullopt;
+    }
+    if (size > max_payload_size) {
+        throw error("frame of " + std::to_string(size) + " bytes exceeds the limit");
+    }
+    std::vector<std::uint8_t> payload(size);
+    if (size > 0 && !read_exact(fd, payload.data(), size)) {
+        throw error("connection closed in the middle of a frame");
+    }
+    return payload;
+}
+
+void write_frame(int fd, const std::vector<std::uint8_t> &frame)
+{
+    std::size_t done = 0;
+    while (done < frame.size()) {
+        // MSG_NOSIGNAL: a peer that went away is an error here rather than a SIGPIPE
+        const auto n = ::send(fd, frame.data() + done, frame.size() - done, MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw std::system_error(errno, std::generic_category(), "send");
+        }
+        done += static_cast<std::size_t>(n);
+    }
+}
+
+int connect(const std::string &socket_path)
+{
+    sockaddr_un address{};
+    if (socket_path.size() >= sizeof(address.sun_path)) {
+        throw std::system_error(ENAMETOOLONG, std::generic_category(), socket_path);
+    }
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path, socket_path.c_str(), socket_path.size() + 1);
+
+    const int fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        throw std::system_error(errno, std::generic_category(), "socket");
+    }
+    if (::connect(fd, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) != 0) {
+        const int err = errno;
+        ::close(fd);
+        throw std::system_error(err, std::generic_category(), "connect to " + socket_path);
+    }
+    return fd;
+}
+
+} // namespace protocol
@@ -0,0 +1,142 @@
+#include "symbolizerd/server.h"
+
+#include <cerrno>
+#include <cstring>
+#include <system_error>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+#include <spdlog/spdlog.h>
+
+namespace {
+
+// how often run() checks whether it was stopped
+constexpr int poll_interval_ms = 200;
+
+[[noreturn]] void throw_errno(const std::string &what)
+{
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+} // namespace
+
+server::server(std::string socket_path, binary_cache &cache) : socket_path_(std::move(socket_path)), cache_(cache)
+{
+    sockaddr_un address{};
+    if (socket_path_.size() >= sizeof(address.sun_path)) {
+        throw std::system_error(ENAMETOOLONG, std::generic_category(), socket_path_);
+    }
+    address.sun_family = AF_UNIX;
+    std::memcpy(address.sun_path, socket_path_.c_str(), socket_path_.size() + 1);
+
+    // a socket file nobody accepts on is left over from a daemon that did not shut down cleanly
+    if (::access(socket_path_.c_str(), F_OK) == 0) {
+        try {
+            ::close(protocol::connect(socket_path_));
+            throw std::system_error(EADDRINUSE, std::generic_category(), "another daemon serves " + socket_path_);
+        }
+        catch (const std::system_error &err) {
+            if (err.code().value() == EADDRINUSE) {
+                throw;
+            }
+            ::unlink(socket_path_.c_str());
+        }
+    }
+
+    listen_fd_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (listen_fd_ < 0) {
+        throw_errno("socket");
+    }
+    if (::bind(listen_fd_, reinterpret_cast<const sockaddr *>(&address), sizeof(address)) != 0 ||
+        ::listen(listen_fd_, SOMAXCONN) != 0) {
+        const int err = errno;
+        ::close(listen_fd_);
+        throw std::system_error(err, std::generic_category(), "listen on " + socket_path_);
+    }
+}
+
+server::~server()
+{
+    ::close(listen_fd_);
+    ::unlink(socket_path_.c_str());
+}
+
+void server::run()
+{
+    while (!stopping_) {
+        pollfd pfd{listen_fd_, POLLIN, 0};
+        const int ready = ::poll(&pfd, 1, poll_interval_ms);
+        if (ready < 0 && errno != EINTR) {
+            throw_errno("poll");
+        }
+        reap();
+        if (ready <= 0) {
+            continue;
+        }
+        const int fd = ::accept4(listen_fd_, nullptr, nullptr, SOCK_CLOEXEC);
+        if (fd < 0) {
+            if (errno != EINTR && errno != ECONNABORTED && errno != EAGAIN) {
+                spdlog::warn("accept failed: {}", std::strerror(errno));
+            }
+            continue;
+        }
+        const std::lock_guard lock(connections_mutex_);
+        auto &c = connections_.emplace_back();
+        c.fd = fd;
+        c.thread = std::thread([this, &c]() { serve(c); });
+    }
+
+    // unblocks the connections waiting for their next request; one in the middle of a batch finishes it first
+    const std::lock_guard lock(connections_mutex_);
+    for (auto &c : connections_) {
+        ::shutdown(c.fd, SHUT_RDWR);
+    }
+    for (auto &c : connections_) {
+        c.thread.join();
+        ::close(c.fd);
+    }
+    connections_.clear();
+}
+
+void server::serve(connection &c)
+{
+    try {
+        while (auto payload = protocol::read_frame(c.fd)) {
+            const auto response = cache_.symbolize(protocol::decode_request(*payload));
+            protocol::write_frame(c.fd, protocol::encode(response));
+        }
+    }
+    catch (const protocol::error &err) {
+        // a client that does not speak the protocol gets an answer before being disconnected, if it still listens
+        spdlog::warn("bad request: {}", err.what());
+        try {
+            protocol::write_frame(c.fd, protocol::encode(
+                                            protocol::response::failure(protocol::status::bad_request, err.what())));
+        }
+        catch (const std::exception &) {
+        }
+    }
+    catch (const std::exception &err) {
+        spdlog::debug("connection closed: {}", err.what());
+    }
+    // the descriptor is closed once the thread is joined, so shutting down connections never hits a reused one
+    c.done = true;
+}
+
+void server::reap()
+{
+    const std::lock_guard lock(connections_mutex_);
+    for (auto it = connections_.begin(); it != connections_.end();) {
+        if (it->done) {
+            it->thread.join();
+            ::close(it->fd);
+            it = connections_.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+}
@@ -1,10 +1,22 @@
 #pragma once
 
+#include <cppdwarf/details/arena.hpp>
 #include <cppdwarf/details/attribute.hpp>
 #include <cppdwarf/details/attribute_list.hpp>
 #include <cppdwarf/details/compilation_unit.hpp>
 #include <cppdwarf/details/compilation_unit_list.hpp>
 #include <cppdwarf/details/debug.hpp>
+#include <cppdwarf/details/debug_set.hpp>
 #include <cppdwarf/details/die.hpp>
 #include <cppdwarf/details/enums.hpp>
+#include <cppdwarf/details/error.hpp>
 #include <cppdwarf/details/exceptions.hpp>
+#include <cppdwarf/details/interner.hpp>
+#include <cppdwarf/details/leb128.hpp>
+#include <cppdwarf/details/memory.hpp>
+#include <cppdwarf/details/native.hpp>
+#include <cppdwarf/details/object.hpp>
+#include <cppdwarf/details/progress.hpp>
+#include <cppdwarf/details/stats.hpp>
+#include <cppdwarf/details/unit_table.hpp>
+#include <cppdwarf/details/walk.hpp>
@@ -0,0 +1,154 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <utility>
+
+#include <cppdwarf/details/exceptions.hpp>
+#include <cppdwarf/details/memory.hpp>
+
+namespace cppdwarf {
+
+// Monotonic memory for the short-lived objects cppdwarf creates while walking DIEs: the dies held by child
+// iterators, attribute lists and their attributes. While an arena is in scope on a thread, these objects take their
+// memory from it instead of the heap; freeing them costs nothing and the memory of a whole unit of work, typically one
+// compilation unit, is handed back at once by reset(). Without an arena in scope the default memory resource is used.
+//
+//     cppdwarf::arena arena;
+//     for (const auto &cu : debug) {
+//         arena.reset();
+//         cppdwarf::arena::scope use(arena);
+//         ...
+//     }
+//
+// An arena is a std::pmr::memory_resource, so std::pmr containers of the caller can share it. It is not thread-safe,
+// use one arena per thread.
+class arena : public std::pmr::memory_resource {
+public:
+    // Makes cppdwarf allocate from an arena on the current thread for the lifetime of the scope
+    class scope {
+    public:
+        explicit scope(arena &a) : previous_(active())
+        {
+            active() = &a;
+        }
+
+        ~scope()
+        {
+            active() = previous_;
+        }
+
+        scope(const scope &) = delete;
+        scope &operator=(const scope &) = delete;
+
+    private:
+        arena *previous_;
+    };
+
+    explicit arena(std::size_t initial_size = 64 * 1024)
+        : buffer_(std::make_unique<std::byte[]>(initial_size)), monotonic_(buffer_.get(), initial_size)
+    {
+    }
+
+    arena(const arena &) = delete;
+    arena &operator=(const arena &) = delete;
+    arena(arena &&) = delete;
+    arena &operator=(arena &&) = delete;
+
+    // Releases the memory of everything allocated since the last reset. Every object allocated from the arena must
+    // have been destroyed by then, otherwise other_error is thrown and nothing is released.
+    void reset()
+    {
+        if (live_ != 0) {
+            throw other_error("arena reset while objects allocated from it are still alive");
+        }
+        monotonic_.release();
+        allocated_ = 0;
+    }
+
+    // number of allocations not deallocated yet
+    [[nodiscard]] std::size_t live() const noexcept
+    {
+        return live_;
+    }
+
+    // bytes handed out since the last reset
+    [[nodiscard]] std::size_t allocated() const noexcept
+    {
+        return allocated_;
+    }
+
+    // The memory resource cppdwarf allocates objects of a category from on the current thread; without an arena the
+    // heap, where the objects are counted by category, see heap_usage
+    [[nodiscard]] static std::pmr::memory_resource *current(memory_category category = memory_category::other) noexcept
+    {
+        if (auto *a = active()) {
+            return a;
+        }
+        return details::heap_resource(category);
+    }
+
+private:
+    static arena *&active() noexcept
+    {
+        thread_local arena *a = nullptr;
+        return a;
+    }
+
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        void *p = monotonic_.allocate(bytes, alignment);
+        ++live_;
+        allocated_ += bytes;
+        return p;
+    }
+
+    void do_deallocate(void *, std::size_t, std::size_t) override
+    {
+        --live_;
+    }
+
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    std::unique_ptr<std::byte[]> buffer_;
+    std::pmr::monotonic_buffer_resource monotonic_;
+    std::size_t live_ = 0;
+    std::size_t allocated_ = 0;
+};
+
+// Destroys an object and gives its memory back to the resource it was allocated from
+template <typename T>
+struct arena_deleter {
+    std::pmr::memory_resource *resource = nullptr;
+
+    void operator()(T *p) const
+    {
+        p->~T();
+        resource->deallocate(p, sizeof(T), alignof(T));
+    }
+};
+
+template <typename T>
+using arena_ptr = std::unique_ptr<T, arena_deleter<T>>;
+
+// Like std::make_unique, but allocates from arena::current(), counted under memory_category_of<T>
+template <typename T, typename... Args>
+arena_ptr<T> make_arena_ptr(Args &&...args)
+{
+    auto *resource = arena::current(memory_category_of<T>::value);
+    void *memory = resource->allocate(sizeof(T), alignof(T));
+    try {
+        return arena_ptr<T>(new (memory) T(std::forward<Args>(args)...), arena_deleter<T>{resource});
+    }
+    catch (...) {
+        resource->deallocate(memory, sizeof(T), alignof(T));
+        throw;
+    }
+}
+
+} // namespace cppdwarf
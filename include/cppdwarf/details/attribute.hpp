@@ -2,8 +2,14 @@
 
 #include <libdwarf.h>
 
+#include <memory>
+#include <optional>
+#include <string>
+
 #include <cppdwarf/details/enums.hpp>
+#include <cppdwarf/details/error.hpp>
 #include <cppdwarf/details/exceptions.hpp>
+#include <cppdwarf/details/stats.hpp>
 
 namespace cppdwarf {
 
@@ -33,71 +39,59 @@ public:
 
     [[nodiscard]] attribute_t type() const
     {
-        Dwarf_Error error = nullptr;
+        auto type = try_type();
+        if (!type) {
+            throw other_error("dwarf_whatattr failed!");
+        }
+        return *type;
+    }
+
+    [[nodiscard]] expected<attribute_t> try_type() const noexcept
+    {
+        dwarf_error error(dbg_);
         Dwarf_Half attr_num = 0;
-        int res = dwarf_whatattr(handle_.get(), &attr_num, &error);
+        int res = details::call<libdwarf_call::whatattr>(dwarf_whatattr, handle_.get(), &attr_num, error.out());
         if (res != DW_DLV_OK) {
-            throw other_error("dwarf_whatattr failed!");
+            return errc_of(res);
         }
         return static_cast<attribute_t>(attr_num);
     }
 
     [[nodiscard]] form form() const
     {
-        Dwarf_Error error = nullptr;
+        auto attr_form = try_form();
+        if (!attr_form) {
+            throw other_error("dwarf_whatform failed!");
+        }
+        return *attr_form;
+    }
+
+    [[nodiscard]] expected<cppdwarf::form> try_form() const noexcept
+    {
+        dwarf_error error(dbg_);
         Dwarf_Half final_form = 0;
-        int res = dwarf_whatform(handle_.get(), &final_form, &error);
+        int res = details::call<libdwarf_call::whatform>(dwarf_whatform, handle_.get(), &final_form, error.out());
         if (res != DW_DLV_OK) {
-            throw other_error("dwarf_whatform failed!");
+            return errc_of(res);
         }
         return static_cast<cppdwarf::form>(final_form);
     }
 
     [[nodiscard]] bool is_string() const noexcept
     {
-        switch (form()) {
-        case form::string:
-        case form::GNU_strp_alt:
-        case form::GNU_str_index:
-        case form::strx:
-        case form::strx1:
-        case form::strx2:
-        case form::strx3:
-        case form::strx4:
-        case form::strp:
-            return true;
-        default:
-            break;
-        }
-        return false;
+        return class_of(try_form().value_or(cppdwarf::form{})) == form_class::string;
     }
 
+    // data16 is a constant too, but does not fit in 64 bits
     [[nodiscard]] bool is_integer() const noexcept
     {
-        switch (form()) {
-        case form::data1:
-        case form::data2:
-        case form::data4:
-        case form::data8:
-        case form::sdata:
-        case form::udata:
-            return true;
-        default:
-            break;
-        }
-        return false;
+        const auto attr_form = try_form().value_or(cppdwarf::form{});
+        return class_of(attr_form) == form_class::constant && attr_form != form::data16;
     }
 
     [[nodiscard]] bool is_boolean() const noexcept
     {
-        switch (form()) {
-        case form::flag:
-        case form::flag_present:
-            return true;
-        default:
-            break;
-        }
-        return false;
+        return class_of(try_form().value_or(cppdwarf::form{})) == form_class::flag;
     }
 
     template <typename T>
@@ -107,87 +101,350 @@ public:
         throw type_error("unsupported type for attribute::get()");
     }
 
+    // Like get(), but reports a form that does not hold a T or a libdwarf error through the result instead of
+    // throwing
+    template <typename T>
+    expected<T> try_get() const
+    {
+        static_assert(sizeof(T) == 0, "unsupported type for attribute::try_get()");
+        return errc::type_mismatch;
+    }
+
 private:
     Dwarf_Debug dbg_;
     handle_t handle_;
 
-    [[nodiscard]] std::int64_t get_integer() const
+    template <typename T>
+    static T value_or_throw(expected<T> &&value, const char *what)
     {
-        if (!is_integer()) {
-            throw type_error("not an integer");
+        if (!value) {
+            throw type_error(value.error() == errc::type_mismatch ? std::string(what) + ": type mismatch"
+                                                                  : std::string(what) + " failed!");
         }
-        if (form() == form::sdata) {
-            Dwarf_Signed value = 0;
-            Dwarf_Error error = nullptr;
-            int res = dwarf_formsdata(handle_.get(), &value, &error);
-            if (res != DW_DLV_OK) {
-                throw type_error("dwarf_formsdata failed!");
-            }
-            return value;
+        return std::move(*value);
+    }
+
+    [[nodiscard]] expected<std::int64_t> try_get_integer() const
+    {
+        const auto attr_form = try_form();
+        if (!attr_form) {
+            return attr_form.error();
+        }
+        if (class_of(*attr_form) != form_class::constant || *attr_form == form::data16) {
+            return errc::type_mismatch;
         }
-        else {
-            Dwarf_Unsigned value = 0;
-            Dwarf_Error error = nullptr;
-            int res = dwarf_formudata(handle_.get(), &value, &error);
+        dwarf_error error(dbg_);
+        if (*attr_form == form::sdata || *attr_form == form::implicit_const) {
+            Dwarf_Signed value = 0;
+            int res = details::call<libdwarf_call::formsdata>(dwarf_formsdata, handle_.get(), &value, error.out());
             if (res != DW_DLV_OK) {
-                throw type_error("dwarf_formudata failed!");
+                return errc_of(res);
             }
             return static_cast<std::int64_t>(value);
         }
+        Dwarf_Unsigned value = 0;
+        int res = details::call<libdwarf_call::formudata>(dwarf_formudata, handle_.get(), &value, error.out());
+        if (res != DW_DLV_OK) {
+            return errc_of(res);
+        }
+        return static_cast<std::int64_t>(value);
     }
 };
 
 template <>
-[[nodiscard]] inline std::string attribute::get<std::string>() const
+[[nodiscard]] inline expected<std::string> attribute::try_get<std::string>() const
 {
-    char *value = nullptr;
-    Dwarf_Error error = nullptr;
-    if (dwarf_formstring(handle_.get(), &value, &error) != DW_DLV_OK) {
-        throw type_error("dwarf_formstring failed!");
-    }
-    std::string result(value);
-    dwarf_dealloc(dbg_, value, DW_DLA_STRING);
-    return result;
+    if (!is_string()) {
+        return errc::type_mismatch;
+    }
+    char *value = nullptr; // points into the string section, not owned
+    dwarf_error error(dbg_);
+    int res = details::call<libdwarf_call::formstring>(dwarf_formstring, handle_.get(), &value, error.out());
+    if (res != DW_DLV_OK) {
+        return errc_of(res);
+    }
+    details::count(details::counter::string_copies);
+    return std::string(value);
 }
 
 template <>
-[[nodiscard]] inline bool attribute::get<bool>() const
+[[nodiscard]] inline expected<bool> attribute::try_get<bool>() const
 {
+    if (!is_boolean()) {
+        return errc::type_mismatch;
+    }
     Dwarf_Bool value = 0;
-    Dwarf_Error error = nullptr;
-    if (dwarf_formflag(handle_.get(), &value, &error) != DW_DLV_OK) {
-        throw type_error("dwarf_formflag failed!");
+    dwarf_error error(dbg_);
+    int res = details::call<libdwarf_call::formflag>(dwarf_formflag, handle_.get(), &value, error.out());
+    if (res != DW_DLV_OK) {
+        return errc_of(res);
     }
     return value != 0;
 }
 
+template <>
+[[nodiscard]] inline expected<std::int64_t> attribute::try_get<std::int64_t>() const
+{
+    return try_get_integer();
+}
+
+template <>
+[[nodiscard]] inline expected<std::uint64_t> attribute::try_get<std::uint64_t>() const
+{
+    auto value = try_get_integer();
+    if (!value) {
+        return value.error();
+    }
+    return static_cast<std::uint64_t>(*value);
+}
+
+template <>
+[[nodiscard]] inline expected<int> attribute::try_get<int>() const
+{
+    auto value = try_get_integer();
+    if (!value) {
+        return value.error();
+    }
+    return static_cast<int>(*value);
+}
+
+template <>
+[[nodiscard]] inline expected<Dwarf_Sig8> attribute::try_get<Dwarf_Sig8>() const
+{
+    if (try_form().value_or(cppdwarf::form{}) != form::ref_sig8) {
+        return errc::type_mismatch;
+    }
+    Dwarf_Sig8 signature;
+    dwarf_error error(dbg_);
+    int res = details::call<libdwarf_call::formsig8>(dwarf_formsig8, handle_.get(), &signature, error.out());
+    if (res != DW_DLV_OK) {
+        return errc_of(res);
+    }
+    return signature;
+}
+
+template <>
+[[nodiscard]] inline std::string attribute::get<std::string>() const
+{
+    return value_or_throw(try_get<std::string>(), "dwarf_formstring");
+}
+
+template <>
+[[nodiscard]] inline bool attribute::get<bool>() const
+{
+    return value_or_throw(try_get<bool>(), "dwarf_formflag");
+}
+
 template <>
 [[nodiscard]] inline int attribute::get<int>() const
 {
-    return static_cast<int>(get_integer());
+    return value_or_throw(try_get<int>(), "integer attribute");
 }
 
 template <>
 [[nodiscard]] inline std::int64_t attribute::get<std::int64_t>() const
 {
-    return get_integer();
+    return value_or_throw(try_get<std::int64_t>(), "integer attribute");
 }
 
 template <>
 [[nodiscard]] inline std::uint64_t attribute::get<std::uint64_t>() const
 {
-    return static_cast<std::uint64_t>(get_integer());
+    return value_or_throw(try_get<std::uint64_t>(), "integer attribute");
 }
 
 template <>
 [[nodiscard]] inline Dwarf_Sig8 attribute::get<Dwarf_Sig8>() const
 {
-    Dwarf_Sig8 signature;
-    Dwarf_Error error = nullptr;
-    if (dwarf_formsig8(handle_.get(), &signature, &error) != DW_DLV_OK) {
-        throw type_error("dwarf_formsig8 failed!");
+    return value_or_throw(try_get<Dwarf_Sig8>(), "dwarf_formsig8");
+}
+
+// The kind of value the well-known attributes hold, used by die::read() to decode them without building attribute
+// objects. Attributes without an entry here have to be read through die::attributes().
+enum class attribute_kind {
+    none,
+    string,
+    integer,
+    flag,
+    reference,
+    access,
+    virtuality,
+};
+
+constexpr attribute_kind kind_of(attribute_t type)
+{
+    switch (type) {
+    case attribute_t::name:
+    case attribute_t::linkage_name:
+    case attribute_t::MIPS_linkage_name:
+    case attribute_t::producer:
+    case attribute_t::comp_dir:
+        return attribute_kind::string;
+    case attribute_t::decl_file:
+    case attribute_t::decl_line:
+    case attribute_t::decl_column:
+    case attribute_t::call_file:
+    case attribute_t::call_line:
+    case attribute_t::call_column:
+    case attribute_t::byte_size:
+    case attribute_t::bit_size:
+    case attribute_t::data_bit_offset:
+    case attribute_t::data_member_location:
+    case attribute_t::alignment:
+    case attribute_t::encoding:
+    case attribute_t::language:
+    case attribute_t::lower_bound:
+    case attribute_t::upper_bound:
+    case attribute_t::count:
+    case attribute_t::defaulted:
+    case attribute_t::calling_convention:
+    case attribute_t::inline_:
+        return attribute_kind::integer;
+    case attribute_t::declaration:
+    case attribute_t::external:
+    case attribute_t::artificial:
+    case attribute_t::explicit_:
+    case attribute_t::prototyped:
+    case attribute_t::export_symbols:
+    case attribute_t::main_subprogram:
+    case attribute_t::enum_class:
+    case attribute_t::deleted:
+    case attribute_t::reference:
+    case attribute_t::rvalue_reference:
+        return attribute_kind::flag;
+    case attribute_t::type:
+    case attribute_t::specification:
+    case attribute_t::abstract_origin:
+    case attribute_t::sibling:
+    case attribute_t::containing_type:
+    case attribute_t::object_pointer:
+    case attribute_t::import:
+        return attribute_kind::reference;
+    case attribute_t::accessibility:
+        return attribute_kind::access;
+    case attribute_t::virtuality:
+        return attribute_kind::virtuality;
+    default:
+        return attribute_kind::none;
+    }
+}
+
+template <attribute_kind Kind>
+struct attribute_kind_traits {
+    static_assert(Kind != attribute_kind::none, "no value type is known for this attribute, use die::attributes()");
+};
+
+template <>
+struct attribute_kind_traits<attribute_kind::string> {
+    using value_type = std::string;
+};
+
+template <>
+struct attribute_kind_traits<attribute_kind::integer> {
+    using value_type = std::int64_t;
+};
+
+template <>
+struct attribute_kind_traits<attribute_kind::flag> {
+    using value_type = bool;
+};
+
+template <>
+struct attribute_kind_traits<attribute_kind::reference> {
+    using value_type = std::size_t; // global offset of the referenced DIE
+};
+
+template <>
+struct attribute_kind_traits<attribute_kind::access> {
+    using value_type = access;
+};
+
+template <>
+struct attribute_kind_traits<attribute_kind::virtuality> {
+    using value_type = virtuality;
+};
+
+template <attribute_t Type>
+using attribute_value_t = typename attribute_kind_traits<kind_of(Type)>::value_type;
+
+// Decodes a raw attribute as the value of an attribute of kind `Kind`, returns an empty optional if its form does not
+// hold such a value, e.g. a data_member_location given as an expression.
+template <attribute_kind Kind>
+std::optional<typename attribute_kind_traits<Kind>::value_type> decode_attribute(Dwarf_Debug dbg, Dwarf_Attribute attr)
+{
+    Dwarf_Half raw_form = 0;
+    dwarf_error error(dbg);
+    if (details::call<libdwarf_call::whatform>(dwarf_whatform, attr, &raw_form, error.out()) != DW_DLV_OK) {
+        throw other_error("dwarf_whatform failed!");
+    }
+    const auto attr_form = static_cast<form>(raw_form);
+
+    // the forms are classified by the same table as the native reader's, see class_of()
+    if constexpr (Kind == attribute_kind::string) {
+        if (class_of(attr_form) != form_class::string) {
+            return std::nullopt;
+        }
+        char *value = nullptr; // points into the string section, not owned
+        if (details::call<libdwarf_call::formstring>(dwarf_formstring, attr, &value, error.out()) != DW_DLV_OK) {
+            throw type_error("dwarf_formstring failed!");
+        }
+        details::count(details::counter::string_copies);
+        return std::string(value);
+    }
+    else if constexpr (Kind == attribute_kind::flag) {
+        if (class_of(attr_form) != form_class::flag) {
+            return std::nullopt;
+        }
+        Dwarf_Bool value = 0;
+        if (details::call<libdwarf_call::formflag>(dwarf_formflag, attr, &value, error.out()) != DW_DLV_OK) {
+            throw type_error("dwarf_formflag failed!");
+        }
+        return value != 0;
+    }
+    else if constexpr (Kind == attribute_kind::reference) {
+        // a type signature names a type unit rather than an offset, see attribute::get<Dwarf_Sig8>()
+        if (class_of(attr_form) != form_class::reference || attr_form == form::ref_sig8) {
+            return std::nullopt;
+        }
+        Dwarf_Off offset = 0;
+        Dwarf_Bool is_info = 0;
+        if (details::call<libdwarf_call::global_formref_b>(dwarf_global_formref_b, attr, &offset, &is_info,
+                                                           error.out()) != DW_DLV_OK) {
+            throw type_error("dwarf_global_formref_b failed!");
+        }
+        return static_cast<std::size_t>(offset);
+    }
+    else {
+        std::int64_t value = 0;
+        switch (attr_form) {
+        case form::sdata:
+        case form::implicit_const: {
+            Dwarf_Signed signed_value = 0;
+            if (details::call<libdwarf_call::formsdata>(dwarf_formsdata, attr, &signed_value, error.out()) !=
+                DW_DLV_OK) {
+                throw type_error("dwarf_formsdata failed!");
+            }
+            value = signed_value;
+            break;
+        }
+        case form::data1:
+        case form::data2:
+        case form::data4:
+        case form::data8:
+        case form::udata: {
+            Dwarf_Unsigned unsigned_value = 0;
+            if (details::call<libdwarf_call::formudata>(dwarf_formudata, attr, &unsigned_value, error.out()) !=
+                DW_DLV_OK) {
+                throw type_error("dwarf_formudata failed!");
+            }
+            value = static_cast<std::int64_t>(unsigned_value);
+            break;
+        }
+        default:
+            return std::nullopt;
+        }
+        return static_cast<typename attribute_kind_traits<Kind>::value_type>(value);
     }
-    return signature;
 }
 
 inline std::ostream &operator<<(std::ostream &os, const attribute &attr)
@@ -2,6 +2,13 @@
 
 #include <functional>
 #include <list>
+#include <memory_resource>
+#include <unordered_map>
+#include <vector>
+
+#include <cppdwarf/details/arena.hpp>
+#include <cppdwarf/details/error.hpp>
+#include <cppdwarf/details/stats.hpp>
 
 namespace cppdwarf {
 
@@ -11,14 +18,16 @@ class attribute_list {
 public:
     attribute_list(Dwarf_Debug dbg, Dwarf_Die die) : dbg_(dbg), die_(die)
     {
-        Dwarf_Error error = nullptr;
+        details::count(details::counter::attribute_lists);
+        dwarf_error error(dbg);
         Dwarf_Attribute *attr_list = nullptr;
         Dwarf_Signed attr_count = 0;
-        int res = dwarf_attrlist(die, &attr_list, &attr_count, &error);
+        int res = details::call<libdwarf_call::attrlist>(dwarf_attrlist, die, &attr_list, &attr_count, error.out());
         if (res == DW_DLV_OK) {
             handle_ = handle_t(attr_list, [&](auto *list) { dwarf_dealloc(dbg_, list, DW_DLA_LIST); });
+            attributes_.reserve(attr_count);
             for (auto i = 0; i < attr_count; i++) {
-                auto &ref = attributes_.emplace_back(std::make_unique<attribute>(dbg, attr_list[i]));
+                auto &ref = attributes_.emplace_back(make_arena_ptr<attribute>(dbg, attr_list[i]));
                 attributes_map_.emplace(ref->type(), ref.get());
             }
         }
@@ -83,8 +92,9 @@ private:
     Dwarf_Debug dbg_;
     Dwarf_Die die_;
     handle_t handle_ = handle_t(nullptr, [](auto *) {});
-    std::vector<std::unique_ptr<attribute>> attributes_;
-    std::unordered_map<attribute_t, attribute *> attributes_map_;
+    // the attributes and both containers come from the arena in scope when the list is built, if any
+    std::pmr::vector<arena_ptr<attribute>> attributes_{arena::current(memory_category::attribute_lists)};
+    std::pmr::unordered_map<attribute_t, attribute *> attributes_map_{arena::current(memory_category::attribute_lists)};
 };
 
 } // namespace cppdwarf
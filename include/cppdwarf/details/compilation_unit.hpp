@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cppdwarf/details/die.hpp>
+#include <cppdwarf/details/stats.hpp>
 
 namespace cppdwarf {
 
@@ -8,7 +9,7 @@ class compilation_unit {
 public:
     compilation_unit(Dwarf_Debug dbg, Dwarf_Die die, bool is_info, std::size_t cu_header_length, int version_stamp,
                      std::size_t abbrev_offset, int address_size)
-        : die_(dbg, die, is_info), is_info_(is_info), cu_header_length_(cu_header_length),
+        : dbg_(dbg), die_(dbg, die, is_info), is_info_(is_info), cu_header_length_(cu_header_length),
           version_stamp_(version_stamp), abbrev_offset_(abbrev_offset), address_size_(address_size)
     {
     }
@@ -18,6 +19,18 @@ public:
         return die_;
     }
 
+    // Look up a DIE of this unit by its global offset, e.g. one recorded during an earlier traversal
+    [[nodiscard]] cppdwarf::die die_at(std::size_t offset) const
+    {
+        Dwarf_Die die = nullptr;
+        dwarf_error error(dbg_);
+        int res = details::call<libdwarf_call::offdie_b>(dwarf_offdie_b, dbg_, offset, is_info_, &die, error.out());
+        if (res != DW_DLV_OK) {
+            throw other_error("dwarf_offdie_b failed!");
+        }
+        return cppdwarf::die(dbg_, die, is_info_);
+    }
+
     [[nodiscard]] std::size_t header_length() const
     {
         return cu_header_length_;
@@ -39,6 +52,7 @@ public:
     }
 
 private:
+    Dwarf_Debug dbg_;
     cppdwarf::die die_;
     bool is_info_;
     std::size_t cu_header_length_;
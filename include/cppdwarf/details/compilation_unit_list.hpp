@@ -1,10 +1,18 @@
 #pragma once
 
+#include <cppdwarf/details/progress.hpp>
+
 namespace cppdwarf {
 
 class compilation_unit_list {
 public:
-    explicit compilation_unit_list(Dwarf_Debug dbg, bool is_info) : dbg_(dbg), is_info_(is_info) {}
+    // With a monitor, every unit done is reported to it and the iteration ends early once its token is cancelled. Like
+    // breaking out of the loop, that leaves libdwarf's position in the middle of the units: the next iteration over
+    // the same Dwarf_Debug continues from there.
+    explicit compilation_unit_list(Dwarf_Debug dbg, bool is_info, scan_monitor *monitor = nullptr)
+        : dbg_(dbg), is_info_(is_info), monitor_(monitor)
+    {
+    }
 
 private:
     template <typename T>
@@ -16,7 +24,8 @@ private:
         using pointer = T *;
         using reference = T &;
 
-        explicit iterator_base(Dwarf_Debug dbg, bool is_info) : dbg_(dbg), is_info_(is_info), done_(false)
+        explicit iterator_base(Dwarf_Debug dbg, bool is_info, scan_monitor *monitor)
+            : dbg_(dbg), is_info_(is_info), done_(false), monitor_(monitor)
         {
             advance();
         }
@@ -55,7 +64,9 @@ private:
         bool is_info_ = true;
         bool done_ = true;
         Dwarf_Unsigned next_cu_header_ = 0;
+        Dwarf_Unsigned cu_header_ = 0; // offset of the current unit
         std::unique_ptr<T> cu_;
+        scan_monitor *monitor_ = nullptr;
 
         void advance()
         {
@@ -63,6 +74,16 @@ private:
                 done_ = true;
                 return;
             }
+            if (monitor_) {
+                if (cu_) {
+                    monitor_->unit_done(next_cu_header_ - cu_header_);
+                }
+                if (monitor_->cancelled()) {
+                    done_ = true;
+                    return;
+                }
+            }
+            cu_header_ = next_cu_header_;
 
             Dwarf_Die cu_die = nullptr;
             Dwarf_Unsigned cu_header_length = 0;
@@ -71,10 +92,11 @@ private:
             Dwarf_Sig8 signature;
             Dwarf_Unsigned typeoffset = 0;
             Dwarf_Half header_cu_type = 0;
-            Dwarf_Error error = nullptr;
-            int res = dwarf_next_cu_header_e(dbg_, is_info_, &cu_die, &cu_header_length, &version_stamp, &abbrev_offset,
-                                             &address_size, &offset_size, &extension_size, &signature, &typeoffset,
-                                             &next_cu_header_, &header_cu_type, &error);
+            dwarf_error error(dbg_);
+            int res = details::call<libdwarf_call::next_cu_header_e>(
+                dwarf_next_cu_header_e, dbg_, is_info_, &cu_die, &cu_header_length, &version_stamp, &abbrev_offset,
+                &address_size, &offset_size, &extension_size, &signature, &typeoffset, &next_cu_header_,
+                &header_cu_type, error.out());
             if (res == DW_DLV_ERROR) {
                 throw invalid_iterator("dwarf_next_cu_header_e failed!");
             }
@@ -94,7 +116,7 @@ public:
 
     iterator begin()
     {
-        return iterator(dbg_, is_info_);
+        return iterator(dbg_, is_info_, monitor_);
     }
 
     iterator end()
@@ -104,7 +126,7 @@ public:
 
     [[nodiscard]] const_iterator begin() const
     {
-        return const_iterator(dbg_, is_info_);
+        return const_iterator(dbg_, is_info_, monitor_);
     }
 
     [[nodiscard]] const_iterator end() const
@@ -114,7 +136,7 @@ public:
 
     [[nodiscard]] const_iterator cbegin() const
     {
-        return const_iterator(dbg_, is_info_);
+        return const_iterator(dbg_, is_info_, monitor_);
     }
 
     [[nodiscard]] const_iterator cend() const
@@ -125,6 +147,7 @@ public:
 private:
     Dwarf_Debug dbg_;
     bool is_info_;
+    scan_monitor *monitor_;
 };
 
 } // namespace cppdwarf
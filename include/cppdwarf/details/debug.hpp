@@ -2,41 +2,91 @@
 
 #include <libdwarf.h>
 
+#include <memory>
+#include <optional>
 #include <string>
+#include <string_view>
+#include <vector>
 
 #include <cppdwarf/details/compilation_unit.hpp>
+#include <cppdwarf/details/compilation_unit_list.hpp>
+#include <cppdwarf/details/error.hpp>
 #include <cppdwarf/details/exceptions.hpp>
+#include <cppdwarf/details/memory.hpp>
+#include <cppdwarf/details/object.hpp>
+#include <cppdwarf/details/progress.hpp>
+#include <cppdwarf/details/stats.hpp>
+#include <cppdwarf/details/unit_table.hpp>
 
 namespace cppdwarf {
 
 class debug {
 public:
-    explicit debug(const std::string &file_path)
+    struct options {
+        // Tally every error libdwarf reports by error number, see errors(). This also installs an error handler, so
+        // libdwarf calls made without a Dwarf_Error argument count the error and return DW_DLV_ERROR instead of
+        // aborting the process. DW_DLV_NO_ENTRY results are not errors and are neither counted nor allocated.
+        bool count_errors = false;
+        // Read the ELF section table directly and load all debug sections up front, decompressing compressed ones
+        // concurrently on `preload_threads` threads (0: one per hardware thread), see elf_object. Files the loader does
+        // not handle, e.g. relocatable objects or binaries whose debug information is in a separate file, are opened
+        // through dwarf_init_path() as usual.
+        bool preload_sections = false;
+        unsigned preload_threads = 0;
+    };
+
+    explicit debug(const std::string &file_path) : debug(file_path, options{}) {}
+
+    debug(const std::string &file_path, const options &opts)
     {
+        if (opts.count_errors) {
+            errors_ = std::make_unique<error_counts>();
+        }
+        if (opts.preload_sections) {
+            try {
+                object_ = std::make_unique<elf_object>(file_path, opts.preload_threads);
+            }
+            catch (const init_error &) {
+                object_.reset(); // libdwarf reads the file itself
+            }
+        }
+        Dwarf_Handler handler = errors_ ? &count_error : nullptr;
         Dwarf_Error error = nullptr;
         Dwarf_Debug dbg = nullptr;
-        int res = dwarf_init_path(file_path.c_str(), nullptr, 0, DW_GROUPNUMBER_ANY, nullptr, nullptr, &dbg, &error);
+        // receives the path of the file actually opened, e.g. a separate debug file found through .gnu_debuglink
+        std::vector<char> true_path(4096, '\0');
+        const auto true_path_size = static_cast<unsigned>(true_path.size());
+        int res = object_ ? dwarf_object_init_b(object_->access_interface(), handler, errors_.get(),
+                                                DW_GROUPNUMBER_ANY, &dbg, &error)
+                          : dwarf_init_path(file_path.c_str(), true_path.data(), true_path_size, DW_GROUPNUMBER_ANY,
+                                            handler, errors_.get(), &dbg, &error);
         if (res != DW_DLV_OK) {
             std::string msg = error ? dwarf_errmsg(error) : "";
             dwarf_dealloc_error(dbg, error);
             dwarf_finish(dbg);
-            throw init_error("dwarf_init_path failed! " + msg);
+            throw init_error(std::string(object_ ? "dwarf_object_init_b" : "dwarf_init_path") + " failed! " + msg);
         }
         dbg_ = dbg;
+        path_ = true_path[0] != '\0' ? std::string(true_path.data()) : file_path;
+        if (errors_) {
+            details::error_registry::add(dbg_, errors_.get());
+        }
     }
 
     // Destructor ensures proper cleanup of Dwarf_Debug
     ~debug()
     {
-        if (dbg_) {
-            dwarf_finish(dbg_);
-        }
+        close();
     }
 
     debug(const debug &) = delete;
     debug &operator=(const debug &) = delete;
 
-    debug(debug &&other) noexcept : dbg_(other.dbg_)
+    // the error counts stay registered under the same Dwarf_Debug and move with it
+    debug(debug &&other) noexcept
+        : dbg_(other.dbg_), path_(std::move(other.path_)), errors_(std::move(other.errors_)),
+          object_(std::move(other.object_)), units_(std::move(other.units_)),
+          libdwarf_sections_(other.libdwarf_sections_)
     {
         other.dbg_ = nullptr;
     }
@@ -44,11 +94,13 @@ public:
     debug &operator=(debug &&other) noexcept
     {
         if (this != &other) {
-            if (dbg_) {
-                dwarf_finish(dbg_);
-                dbg_ = nullptr;
-            }
+            close();
             dbg_ = other.dbg_;
+            path_ = std::move(other.path_);
+            errors_ = std::move(other.errors_);
+            object_ = std::move(other.object_);
+            units_ = std::move(other.units_);
+            libdwarf_sections_ = other.libdwarf_sections_;
             other.dbg_ = nullptr;
         }
         return *this;
@@ -83,13 +135,165 @@ public:
         return compilation_unit_list(dbg_, true);
     }
 
+    // The compilation units, each reported to `monitor` once done; the iteration ends early if the monitor's token is
+    // cancelled. The totals are taken from units(), which is built first if needed.
+    [[nodiscard]] compilation_unit_list compilation_units(scan_monitor &monitor) const
+    {
+        const auto &table = units();
+        monitor.set_totals(table.size(), table.bytes());
+        return compilation_unit_list(dbg_, true, &monitor);
+    }
+
     [[nodiscard]] compilation_unit_list type_units() const
     {
         return compilation_unit_list(dbg_, false);
     }
 
+    // The headers of the units in .debug_info, read on first use. See unit_table for how they are read; the table has
+    // to be built before, not while, iterating over the compilation units when .debug_info is compressed.
+    [[nodiscard]] const unit_table &units() const
+    {
+        if (!units_) {
+            units_ = std::make_unique<unit_table>(dbg_, path_, object_.get());
+        }
+        return *units_;
+    }
+
+    // The unit at `index` in units(), without iterating over the units before it
+    [[nodiscard]] compilation_unit unit(std::size_t index) const
+    {
+        const auto &h = units().at(index);
+        Dwarf_Die die = nullptr;
+        dwarf_error error(dbg_);
+        int res = details::call<libdwarf_call::offdie_b>(dwarf_offdie_b, dbg_, h.die_offset, true, &die, error.out());
+        if (res != DW_DLV_OK) {
+            throw other_error("dwarf_offdie_b failed!");
+        }
+        // like dwarf_next_cu_header_e(), the length does not count the initial length field
+        const auto length_size = h.offset_size == 8 ? 12 : 4;
+        return {dbg_, die, true, h.length - length_size, h.version, h.abbrev_offset, h.address_size};
+    }
+
+    // path of the file the debug information is read from
+    [[nodiscard]] const std::string &path() const
+    {
+        return path_;
+    }
+
+    // the underlying libdwarf handle, for readers that work on the sections directly
+    [[nodiscard]] Dwarf_Debug handle() const
+    {
+        return dbg_;
+    }
+
+    // the errors libdwarf reported so far, nullptr unless opened with options::count_errors
+    [[nodiscard]] const error_counts *errors() const
+    {
+        return errors_.get();
+    }
+
+    // the object serving the sections to libdwarf, nullptr unless they were preloaded, see options::preload_sections
+    [[nodiscard]] const elf_object *object() const
+    {
+        return object_.get();
+    }
+
+    // how long loading each preloaded section took, empty unless the sections were preloaded
+    [[nodiscard]] const std::vector<section_load_time> &section_load_times() const
+    {
+        static const std::vector<section_load_time> none;
+        return object_ ? object_->load_times() : none;
+    }
+
+    // The memory this debug object holds, by subsystem. What the wrappers allocate while reading DIEs is not tied to a
+    // debug object, see heap().
+    [[nodiscard]] memory_usage memory() const
+    {
+        memory_usage usage;
+        if (object_) {
+            usage.preloaded_sections = object_->memory();
+        }
+        else {
+            usage.libdwarf_sections = libdwarf_section_bytes();
+        }
+        if (units_) {
+            usage.unit_table = units_->memory();
+        }
+        return usage;
+    }
+
+    // Snapshot of the heap memory the wrappers hold, by category, only filled in when built with CPPDWARF_STATS (check
+    // heap_usage::enabled). Process-wide, like stats().
+    [[nodiscard]] static heap_usage heap()
+    {
+        return details::heap_snapshot();
+    }
+
+    // Snapshot of the performance counters, only filled in when built with CPPDWARF_STATS (check perf_stats::enabled).
+    // The counters are process-wide: they add up the work of every debug object on every thread since the start or the
+    // last reset_stats().
+    [[nodiscard]] static perf_stats stats()
+    {
+        return details::perf_snapshot();
+    }
+
+    // also restarts the peaks of heap() from what is held now
+    static void reset_stats()
+    {
+        details::perf_reset();
+        details::heap_reset_peak();
+    }
+
 private:
+    // error handler installed with options::count_errors, libdwarf keeps the error record and frees it in dwarf_finish
+    static void count_error(Dwarf_Error error, Dwarf_Ptr arg)
+    {
+        static_cast<error_counts *>(arg)->add(error);
+    }
+
+    // the sizes of the .debug_* and .zdebug_* sections, added up once
+    std::size_t libdwarf_section_bytes() const
+    {
+        if (!libdwarf_sections_) {
+            std::size_t bytes = 0;
+            const int count = dwarf_get_section_count(dbg_);
+            for (int i = 0; i < count; ++i) {
+                const char *name = nullptr;
+                Dwarf_Addr addr = 0;
+                Dwarf_Unsigned size = 0, flags = 0, offset = 0;
+                dwarf_error error(dbg_);
+                if (dwarf_get_section_info_by_index_a(dbg_, i, &name, &addr, &size, &flags, &offset, error.out()) !=
+                        DW_DLV_OK ||
+                    !name) {
+                    continue;
+                }
+                const std::string_view section(name);
+                if (section.rfind(".debug_", 0) == 0 || section.rfind(".zdebug_", 0) == 0) {
+                    bytes += static_cast<std::size_t>(size);
+                }
+            }
+            libdwarf_sections_ = bytes;
+        }
+        return *libdwarf_sections_;
+    }
+
+    void close()
+    {
+        if (dbg_) {
+            if (errors_) {
+                details::error_registry::remove(dbg_);
+            }
+            dwarf_finish(dbg_);
+            dbg_ = nullptr;
+        }
+    }
+
     Dwarf_Debug dbg_ = nullptr;
+    std::string path_;
+    std::unique_ptr<error_counts> errors_;
+    std::unique_ptr<elf_object> object_; // outlives dbg_, close() finishes it first
+    mutable std::unique_ptr<unit_table> units_;
+    mutable std::optional<std::size_t> libdwarf_sections_;
 };
 
 } // namespace cppdwarf
@@ -0,0 +1,403 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cppdwarf/details/debug.hpp>
+#include <cppdwarf/details/exceptions.hpp>
+#include <cppdwarf/details/interner.hpp>
+
+namespace cppdwarf {
+
+namespace details {
+
+// where debug_set::for_each() collects the results of its function
+template <typename T>
+struct result_slots {
+    using type = std::unique_ptr<T[]>;
+};
+
+template <>
+struct result_slots<void> {
+    using type = int;
+};
+
+} // namespace details
+
+// Many binaries, e.g. the shared libraries of a process, each read through its own debug object, with a cap on how
+// many are open at the same time and one string_interner for all of them.
+//
+// Binaries are added by path and opened by the first acquire(). Once more than options::max_open are open, or the
+// open ones hold more than options::memory_budget, the least recently used ones nobody holds are closed, and opened
+// again by the next acquire(); the state of a debug object, such as its unit table, is lost when it is closed. The
+// limits are exceeded while the binaries over them are held. The memory of a binary is taken from debug::memory()
+// each time a handle to it is released, and the binary released last stays open even if the budget is exceeded, so
+// one that alone is over the budget is not closed and reopened on every use.
+//
+//     cppdwarf::debug_set set;
+//     for (const auto &path : paths) {
+//         set.add(path);
+//     }
+//     auto producers = set.for_each([&](std::size_t index, const cppdwarf::debug &debug) {
+//         std::vector<std::string_view> result;
+//         for (const auto &cu : debug) {
+//             result.push_back(set.producer(cu));
+//         }
+//         return result;
+//     });
+//
+// Thread-safe: each debug object is used by one thread at a time, acquire() waits for the handle another thread holds.
+class debug_set {
+public:
+    struct options {
+        std::size_t max_open = 64;
+        std::size_t memory_budget = 0; // bytes, 0 for no limit
+        debug::options debug_options;
+    };
+
+    struct stats {
+        std::size_t binaries = 0;
+        std::size_t open = 0;    // open now
+        std::size_t memory = 0;  // held by the open binaries, as of the release of their last handle
+        std::size_t opened = 0;  // debug objects created, reopening included
+        std::size_t evicted = 0; // closed to stay under options::max_open or options::memory_budget
+        std::size_t failed = 0;  // attempts to open a binary that failed
+    };
+
+private:
+    struct entry {
+        std::string path;
+        std::mutex mutex; // held by the handle using the debug object
+        std::unique_ptr<debug> dbg;
+
+        // guarded by the set's mutex
+        std::string error;    // why the binary could not be opened
+        std::size_t pins = 0; // handles held or waited for
+        std::size_t memory = 0;
+        std::list<entry *>::iterator lru_position;
+    };
+
+public:
+    // Exclusive use of one open debug object, which stays open while the handle lives
+    class handle {
+    public:
+        handle(const handle &) = delete;
+        handle &operator=(const handle &) = delete;
+
+        handle(handle &&other) noexcept : set_(std::exchange(other.set_, nullptr)), entry_(other.entry_) {}
+
+        ~handle()
+        {
+            if (set_) {
+                const auto memory = entry_->dbg->memory().total();
+                entry_->mutex.unlock();
+                set_->unpin(*entry_, memory);
+            }
+        }
+
+        [[nodiscard]] const debug &operator*() const
+        {
+            return *entry_->dbg;
+        }
+
+        [[nodiscard]] const debug *operator->() const
+        {
+            return entry_->dbg.get();
+        }
+
+    private:
+        friend class debug_set;
+
+        // takes over the lock of the entry's mutex
+        handle(debug_set &set, entry &e) : set_(&set), entry_(&e) {}
+
+        debug_set *set_;
+        entry *entry_;
+    };
+
+    debug_set() : debug_set(options{}) {}
+
+    explicit debug_set(const options &opts) : options_(opts)
+    {
+        options_.max_open = std::max<std::size_t>(1, options_.max_open);
+    }
+
+    debug_set(const debug_set &) = delete;
+    debug_set &operator=(const debug_set &) = delete;
+
+    // Adds a binary to open later, returns its index; adding the same path again returns the index it already has
+    std::size_t add(const std::string &path)
+    {
+        const std::lock_guard lock(mutex_);
+        for (std::size_t i = 0; i < entries_.size(); ++i) {
+            if (entries_[i]->path == path) {
+                return i;
+            }
+        }
+        auto &e = entries_.emplace_back(std::make_unique<entry>());
+        e->path = path;
+        e->lru_position = lru_.end();
+        return entries_.size() - 1;
+    }
+
+    [[nodiscard]] std::size_t size() const
+    {
+        const std::lock_guard lock(mutex_);
+        return entries_.size();
+    }
+
+    // the path the binary was added with, debug::path() may differ
+    [[nodiscard]] std::string path(std::size_t index) const
+    {
+        const std::lock_guard lock(mutex_);
+        return at(index).path;
+    }
+
+    // Opens the binary if it is not open and waits until no other handle uses it. Throws out_of_range for an unknown
+    // index and init_error if the binary cannot be opened, which is tried again by the next call.
+    handle acquire(std::size_t index)
+    {
+        entry *e = nullptr;
+        {
+            const std::lock_guard lock(mutex_);
+            e = &at(index);
+            ++e->pins;
+            touch(*e);
+        }
+        std::unique_lock entry_lock(e->mutex);
+        if (!e->dbg) {
+            // the binary takes its slot before it is opened, and the ones it displaces are closed first, so the cap
+            // also holds while binaries are being opened
+            {
+                std::vector<std::unique_ptr<debug>> closed;
+                const std::lock_guard lock(mutex_);
+                ++open_;
+                evict(closed);
+            }
+            try {
+                e->dbg = std::make_unique<debug>(e->path, options_.debug_options);
+            }
+            catch (const std::exception &err) {
+                entry_lock.unlock();
+                {
+                    const std::lock_guard lock(mutex_);
+                    e->error = err.what();
+                    --open_;
+                    ++failed_;
+                }
+                unpin(*e);
+                throw;
+            }
+            const std::lock_guard lock(mutex_);
+            e->error.clear();
+            ++opened_;
+            touch(*e);
+        }
+        entry_lock.release();
+        return {*this, *e};
+    }
+
+    // why the last attempt to open the binary failed, empty if it did not
+    [[nodiscard]] std::string error(std::size_t index) const
+    {
+        const std::lock_guard lock(mutex_);
+        return at(index).error;
+    }
+
+    // the strings shared by all binaries of the set, see src_files(), name() and producer()
+    [[nodiscard]] string_interner &strings()
+    {
+        return strings_;
+    }
+
+    // The functions below read the strings of a unit of one of the binaries and return their copies in strings(), which
+    // stay valid once the binary is released or closed; equal strings of different binaries are stored once.
+
+    // the unit's source files, indexed like die::src_files(), as normal paths, see string_interner::intern_path()
+    [[nodiscard]] std::vector<std::string_view> src_files(const compilation_unit &cu)
+    {
+        const auto files = cu.die().src_files();
+        std::vector<std::string_view> result;
+        result.reserve(files.size());
+        for (const auto &file : files) {
+            result.push_back(strings_.intern_path(file));
+        }
+        return result;
+    }
+
+    // the unit's DW_AT_name, empty if it has none
+    [[nodiscard]] std::string_view name(const compilation_unit &cu)
+    {
+        auto [name] = cu.die().read<attribute_t::name>();
+        return strings_.intern(name.value_or(""));
+    }
+
+    // the unit's DW_AT_producer, empty if it has none
+    [[nodiscard]] std::string_view producer(const compilation_unit &cu)
+    {
+        auto [producer] = cu.die().read<attribute_t::producer>();
+        return strings_.intern(producer.value_or(""));
+    }
+
+    // Calls `f(index, debug)` for every binary on up to `threads` threads (0: one per hardware thread, never more than
+    // options::max_open) and returns the results in the order of the binaries. Binaries that cannot be opened are
+    // skipped, their result is value-initialized; see error(). The first exception thrown by `f` is rethrown once all
+    // threads are done, the binaries not started by then are not visited.
+    template <typename F>
+    auto for_each(F &&f, unsigned threads = 0)
+    {
+        using result_type = std::invoke_result_t<F &, std::size_t, const debug &>;
+        const auto count = size();
+        if (threads == 0) {
+            threads = std::max(1U, std::thread::hardware_concurrency());
+        }
+        const auto num_threads = std::min({static_cast<std::size_t>(threads), options_.max_open, count});
+
+        // one slot per binary rather than a vector, whose elements, if bools, could not be written concurrently
+        typename details::result_slots<result_type>::type results{};
+        if constexpr (!std::is_void_v<result_type>) {
+            results = std::make_unique<result_type[]>(count);
+        }
+        std::atomic<std::size_t> next{0};
+        std::mutex mutex;
+        std::exception_ptr error;
+        auto worker = [&]() {
+            for (auto i = next++; i < count; i = next++) {
+                try {
+                    std::optional<handle> h;
+                    try {
+                        h.emplace(acquire(i));
+                    }
+                    catch (const init_error &) {
+                        continue;
+                    }
+                    if constexpr (std::is_void_v<result_type>) {
+                        f(i, **h);
+                    }
+                    else {
+                        results[i] = f(i, **h);
+                    }
+                }
+                catch (...) {
+                    std::lock_guard lock(mutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                    next = count; // stop the other workers
+                }
+            }
+        };
+
+        std::vector<std::thread> pool;
+        for (std::size_t i = 1; i < num_threads; ++i) {
+            pool.emplace_back(worker);
+        }
+        worker();
+        for (auto &thread : pool) {
+            thread.join();
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+        if constexpr (!std::is_void_v<result_type>) {
+            return std::vector<result_type>(std::make_move_iterator(results.get()),
+                                            std::make_move_iterator(results.get() + count));
+        }
+    }
+
+    [[nodiscard]] stats get_stats() const
+    {
+        const std::lock_guard lock(mutex_);
+        return {entries_.size(), open_, memory_, opened_, evicted_, failed_};
+    }
+
+private:
+    entry &at(std::size_t index) const
+    {
+        if (index >= entries_.size()) {
+            throw out_of_range("debug_set index " + std::to_string(index) + " out of range");
+        }
+        return *entries_[index];
+    }
+
+    // The functions below are called with mutex_ held
+
+    // moves an open binary to the front of the LRU list
+    void touch(entry &e)
+    {
+        if (e.lru_position != lru_.end()) {
+            lru_.splice(lru_.begin(), lru_, e.lru_position);
+        }
+        else if (e.dbg) {
+            lru_.push_front(&e);
+            e.lru_position = lru_.begin();
+        }
+    }
+
+    [[nodiscard]] bool over_limits() const
+    {
+        return open_ > options_.max_open || (options_.memory_budget != 0 && memory_ > options_.memory_budget);
+    }
+
+    // Closes the least recently used binaries no handle pins until the open ones are within the limits; `keep` is
+    // only closed to stay under options::max_open. Their debug objects are moved to `closed`, to be destroyed after
+    // the lock is released.
+    void evict(std::vector<std::unique_ptr<debug>> &closed, const entry *keep = nullptr)
+    {
+        auto it = lru_.end();
+        while (over_limits() && it != lru_.begin()) {
+            --it;
+            auto *e = *it;
+            if (e->pins > 0 || (e == keep && open_ <= options_.max_open)) {
+                continue;
+            }
+            // no handle pins the entry, so no thread holds or waits for its mutex
+            closed.push_back(std::move(e->dbg));
+            e->lru_position = lru_.end();
+            it = lru_.erase(it);
+            memory_ -= e->memory;
+            e->memory = 0;
+            --open_;
+            ++evicted_;
+        }
+    }
+
+    void unpin(entry &e, std::optional<std::size_t> memory = std::nullopt)
+    {
+        std::vector<std::unique_ptr<debug>> closed;
+        const std::lock_guard lock(mutex_);
+        --e.pins;
+        if (memory) {
+            memory_ = memory_ - e.memory + *memory;
+            e.memory = *memory;
+        }
+        // the binary just released is the one most likely to be used next
+        evict(closed, &e);
+    }
+
+    options options_;
+    mutable std::mutex mutex_;
+    std::vector<std::unique_ptr<entry>> entries_;
+    std::list<entry *> lru_; // the open binaries, most recently used first
+    std::size_t open_ = 0;
+    std::size_t memory_ = 0;
+    std::size_t opened_ = 0;
+    std::size_t evicted_ = 0;
+    std::size_t failed_ = 0;
+    string_interner strings_;
+};
+
+} // namespace cppdwarf
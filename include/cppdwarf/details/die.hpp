@@ -1,16 +1,76 @@
 #pragma once
 
+#include <dwarf.h>
 #include <libdwarf.h>
 
+#include <algorithm>
+#include <bitset>
+#include <initializer_list>
 #include <iomanip>
+#include <optional>
+#include <tuple>
+#include <utility>
 #include <vector>
 
+#include <cppdwarf/details/arena.hpp>
 #include <cppdwarf/details/attribute.hpp>
 #include <cppdwarf/details/attribute_list.hpp>
 #include <cppdwarf/details/enums.hpp>
+#include <cppdwarf/details/error.hpp>
+#include <cppdwarf/details/stats.hpp>
 
 namespace cppdwarf {
 
+// A set of tags to filter the children of a DIE by, e.g. tag_set{tag::namespace_, tag::class_type}
+class tag_set {
+public:
+    tag_set(std::initializer_list<tag> tags)
+    {
+        for (const auto t : tags) {
+            insert(t);
+        }
+    }
+
+    void insert(tag t)
+    {
+        const auto value = static_cast<std::size_t>(t);
+        if (value < standard_.size()) {
+            standard_.set(value);
+        }
+        else {
+            vendor_.push_back(value);
+        }
+    }
+
+    [[nodiscard]] bool contains(tag t) const
+    {
+        const auto value = static_cast<std::size_t>(t);
+        if (value < standard_.size()) {
+            return standard_.test(value);
+        }
+        return std::find(vendor_.begin(), vendor_.end(), value) != vendor_.end();
+    }
+
+private:
+    std::bitset<DW_TAG_lo_user> standard_;
+    std::vector<std::size_t> vendor_; // tags in the user range, rarely more than one or two
+};
+
+// A [low, high) range of code addresses, see die::address_ranges()
+struct address_range {
+    Dwarf_Addr low = 0;
+    Dwarf_Addr high = 0;
+};
+
+// A row of a CU's line table, see die::line_table()
+struct line_row {
+    Dwarf_Addr address = 0;
+    std::size_t file = 0; // indexes the CU DIE's src_files() the way DW_AT_decl_file does
+    std::size_t line = 0;
+    std::size_t column = 0;
+    bool end_sequence = false; // the first address after a sequence of code, the row has no location
+};
+
 class die {
     using handle_t = std::unique_ptr<Dwarf_Die_s, decltype(&dwarf_dealloc_die)>;
 
@@ -18,7 +78,7 @@ public:
     explicit die(Dwarf_Debug dbg, Dwarf_Die die, bool is_info)
         : dbg_(dbg), handle_(die, dwarf_dealloc_die), is_info_(is_info)
     {
-        attributes_ = std::make_unique<attribute_list>(dbg_, handle_.get());
+        details::count(details::counter::dies);
     }
 
     die(const die &) = delete;
@@ -28,25 +88,43 @@ public:
     die &operator=(die &&other) = default;
 
     [[nodiscard]] std::size_t offset() const
+    {
+        auto offset = try_offset();
+        if (!offset) {
+            throw other_error("dwarf_dieoffset failed!");
+        }
+        return *offset;
+    }
+
+    [[nodiscard]] expected<std::size_t> try_offset() const noexcept
     {
         Dwarf_Off offset = 0;
-        Dwarf_Error error = nullptr;
-        int res = dwarf_dieoffset(handle_.get(), &offset, &error);
+        dwarf_error error(dbg_);
+        int res = details::call<libdwarf_call::dieoffset>(dwarf_dieoffset, handle_.get(), &offset, error.out());
         if (res != DW_DLV_OK) {
-            throw other_error("dwarf_dieoffset failed!");
+            return errc_of(res);
         }
-        return offset;
+        return static_cast<std::size_t>(offset);
     }
 
     [[nodiscard]] std::size_t cu_offset() const
+    {
+        auto offset = try_cu_offset();
+        if (!offset) {
+            throw other_error("dwarf_die_CU_offset failed!");
+        }
+        return *offset;
+    }
+
+    [[nodiscard]] expected<std::size_t> try_cu_offset() const noexcept
     {
         Dwarf_Off offset = 0;
-        Dwarf_Error error = nullptr;
-        int res = dwarf_die_CU_offset(handle_.get(), &offset, &error);
+        dwarf_error error(dbg_);
+        int res = details::call<libdwarf_call::die_CU_offset>(dwarf_die_CU_offset, handle_.get(), &offset, error.out());
         if (res != DW_DLV_OK) {
-            throw other_error("dwarf_die_CU_offset failed!");
+            return errc_of(res);
         }
-        return offset;
+        return static_cast<std::size_t>(offset);
     }
 
     [[nodiscard]] bool is_info() const
@@ -64,16 +142,17 @@ private:
         using pointer = T *;
         using reference = T &;
 
-        iterator_base(Dwarf_Debug dbg, Dwarf_Die parent_die, bool is_info) : dbg_(dbg), is_info_(is_info)
+        iterator_base(Dwarf_Debug dbg, Dwarf_Die parent_die, bool is_info, const tag_set *filter = nullptr)
+            : dbg_(dbg), is_info_(is_info), filter_(filter)
         {
             if (parent_die) {
                 Dwarf_Die child = nullptr;
-                Dwarf_Error error = nullptr;
-                if (dwarf_child(parent_die, &child, &error) != DW_DLV_OK) {
+                dwarf_error error(dbg_);
+                if (details::call<libdwarf_call::child>(dwarf_child, parent_die, &child, error.out()) != DW_DLV_OK) {
                     current_die_ = nullptr;
                     return;
                 }
-                current_die_ = std::make_unique<die>(dbg_, child, is_info_);
+                set_current(child);
             }
         }
 
@@ -82,18 +161,7 @@ private:
             if (!current_die_) {
                 return *this;
             }
-            Dwarf_Error error = nullptr;
-            Dwarf_Die next_die = nullptr;
-            int result = dwarf_siblingof_c(current_die_->handle_.get(), &next_die, &error);
-            if (result == DW_DLV_NO_ENTRY) {
-                current_die_ = nullptr;
-            }
-            else if (result != DW_DLV_OK) {
-                throw invalid_iterator("dwarf_siblingof_c failed!");
-            }
-            else {
-                current_die_ = std::make_unique<die>(dbg_, next_die, is_info_);
-            }
+            set_current(next_sibling(current_die_->handle_.get()));
             return *this;
         }
 
@@ -116,9 +184,79 @@ private:
         }
 
     private:
+        Dwarf_Die next_sibling(Dwarf_Die raw_die) const
+        {
+            dwarf_error error(dbg_);
+            Dwarf_Die next_die = nullptr;
+            int result = details::call<libdwarf_call::siblingof_c>(dwarf_siblingof_c, raw_die, &next_die, error.out());
+            if (result == DW_DLV_NO_ENTRY) {
+                return nullptr;
+            }
+            if (result != DW_DLV_OK) {
+                throw invalid_iterator("dwarf_siblingof_c failed!");
+            }
+            return next_die;
+        }
+
+        // Skips siblings whose tag is not in the filter. They are only looked at as raw handles: no die or
+        // attribute list is built for them, and dwarf_siblingof_c jumps over their children via DW_AT_sibling.
+        void set_current(Dwarf_Die raw_die)
+        {
+            while (raw_die && filter_) {
+                Dwarf_Half raw_tag = 0;
+                dwarf_error error(dbg_);
+                if (details::call<libdwarf_call::tag>(dwarf_tag, raw_die, &raw_tag, error.out()) != DW_DLV_OK) {
+                    dwarf_dealloc_die(raw_die);
+                    throw invalid_iterator("dwarf_tag failed!");
+                }
+                if (filter_->contains(static_cast<cppdwarf::tag>(raw_tag))) {
+                    break;
+                }
+                Dwarf_Die next_die = nullptr;
+                try {
+                    next_die = next_sibling(raw_die);
+                }
+                catch (...) {
+                    dwarf_dealloc_die(raw_die);
+                    throw;
+                }
+                dwarf_dealloc_die(raw_die);
+                raw_die = next_die;
+            }
+            current_die_ = raw_die ? make_arena_ptr<die>(dbg_, raw_die, is_info_) : nullptr;
+        }
+
         Dwarf_Debug dbg_;
-        std::unique_ptr<die> current_die_ = nullptr;
+        arena_ptr<die> current_die_ = nullptr;
         bool is_info_;
+        const tag_set *filter_;
+    };
+
+    // The children of a DIE whose tag is in a tag_set
+    class filtered_children {
+    public:
+        using const_iterator = iterator_base<const die>;
+
+        filtered_children(Dwarf_Debug dbg, Dwarf_Die parent_die, bool is_info, const tag_set &tags)
+            : dbg_(dbg), parent_die_(parent_die), is_info_(is_info), tags_(tags)
+        {
+        }
+
+        [[nodiscard]] const_iterator begin() const
+        {
+            return {dbg_, parent_die_, is_info_, &tags_};
+        }
+
+        [[nodiscard]] const_iterator end() const
+        {
+            return {dbg_, nullptr, is_info_, &tags_};
+        }
+
+    private:
+        Dwarf_Debug dbg_;
+        Dwarf_Die parent_die_;
+        bool is_info_;
+        tag_set tags_; // a copy: the set passed to children() is often a temporary gone before the loop starts
     };
 
 public:
@@ -145,32 +283,114 @@ public:
         return {dbg_, nullptr, is_info_};
     }
 
+    // First child with one of the given tags, `tags` has to outlive the iterator
+    [[nodiscard]] const_iterator begin(const tag_set &tags) const
+    {
+        return {dbg_, handle_.get(), is_info_, &tags};
+    }
+
+    // Iterates over the children with one of the given tags, e.g.
+    //     for (const auto &child : die.children({tag::namespace_, tag::structure_type})) { ... }
+    // Other children and everything below them are skipped without being materialized, which makes scanning for
+    // declarations cheap in CUs dominated by large function bodies.
+    [[nodiscard]] filtered_children children(const tag_set &tags) const
+    {
+        return {dbg_, handle_.get(), is_info_, tags};
+    }
+
     [[nodiscard]] tag tag() const
     {
-        Dwarf_Half tag;
-        Dwarf_Error error = nullptr;
-        int res = dwarf_tag(handle_.get(), &tag, &error);
-        if (res == DW_DLV_ERROR) {
+        auto tag = try_tag();
+        if (!tag) {
             throw other_error("dwarf_tag failed!");
         }
+        return *tag;
+    }
+
+    [[nodiscard]] expected<cppdwarf::tag> try_tag() const noexcept
+    {
+        Dwarf_Half tag = 0;
+        dwarf_error error(dbg_);
+        int res = details::call<libdwarf_call::tag>(dwarf_tag, handle_.get(), &tag, error.out());
+        if (res != DW_DLV_OK) {
+            return errc_of(res);
+        }
         return static_cast<cppdwarf::tag>(tag);
     }
 
+    // Looks up a single attribute without building the attribute list, errc::no_entry if the DIE does not have it
+    [[nodiscard]] expected<attribute> try_attribute(attribute_t type) const
+    {
+        Dwarf_Attribute attr = nullptr;
+        dwarf_error error(dbg_);
+        int res = details::call<libdwarf_call::attr>(dwarf_attr, handle_.get(), static_cast<Dwarf_Half>(type), &attr,
+                                                     error.out());
+        if (res != DW_DLV_OK) {
+            return errc_of(res);
+        }
+        return attribute(dbg_, attr);
+    }
+
+    // The attribute list is only built on first use, so DIEs that are skipped based on their tag stay cheap.
     [[nodiscard]] const attribute_list &attributes() const
     {
+        if (!attributes_) {
+            attributes_ = make_arena_ptr<attribute_list>(dbg_, handle_.get());
+        }
         return *attributes_;
     }
 
+    // Reads a fixed set of attributes in a single pass over the raw attribute list, without building the attribute
+    // list or any attribute objects, e.g.
+    //     auto [name, decl_line] = die.read<attribute_t::name, attribute_t::decl_line>();
+    // Each value is empty if the DIE does not have the attribute, see attribute_value_t for the value types.
+    template <attribute_t... Types>
+    [[nodiscard]] std::tuple<std::optional<attribute_value_t<Types>>...> read() const
+    {
+        std::tuple<std::optional<attribute_value_t<Types>>...> result;
+        Dwarf_Attribute *attr_list = nullptr;
+        Dwarf_Signed attr_count = 0;
+        dwarf_error error(dbg_);
+        int res = details::call<libdwarf_call::attrlist>(dwarf_attrlist, handle_.get(), &attr_list, &attr_count,
+                                                         error.out());
+        if (res == DW_DLV_NO_ENTRY) {
+            return result;
+        }
+        if (res != DW_DLV_OK) {
+            throw other_error("dwarf_attrlist failed!");
+        }
+
+        auto release = [&](Dwarf_Signed from) {
+            for (auto i = from; i < attr_count; i++) {
+                dwarf_dealloc_attribute(attr_list[i]);
+            }
+            dwarf_dealloc(dbg_, attr_list, DW_DLA_LIST);
+        };
+        for (Dwarf_Signed i = 0; i < attr_count; i++) {
+            try {
+                read_into<Types...>(attr_list[i], result, std::make_index_sequence<sizeof...(Types)>{});
+            }
+            catch (...) {
+                release(i);
+                throw;
+            }
+            dwarf_dealloc_attribute(attr_list[i]);
+        }
+        release(attr_count);
+        return result;
+    }
+
     [[nodiscard]] std::vector<std::string> src_files() const
     {
         char **srcfiles = nullptr;
         Dwarf_Signed count = 0;
-        Dwarf_Error error = nullptr;
-        int res = dwarf_srcfiles(handle_.get(), &srcfiles, &count, &error);
+        dwarf_error error(dbg_);
+        int res = details::call<libdwarf_call::srcfiles>(dwarf_srcfiles, handle_.get(), &srcfiles, &count, error.out());
         if (res != DW_DLV_OK) {
             throw other_error("dwarf_srcfiles failed!");
         }
 
+        details::count(details::counter::string_copies, static_cast<std::uint64_t>(count));
         std::vector<std::string> result;
         for (int i = 0; i < count; ++i) {
             result.emplace_back(srcfiles[i]);
@@ -181,6 +401,115 @@ public:
         return result;
     }
 
+    // The rows of the line table of a CU DIE, in the order of the table: sorted by address within each sequence, the
+    // sequences in no particular order. Empty if the unit has no line table.
+    [[nodiscard]] std::vector<line_row> line_table() const
+    {
+        Dwarf_Unsigned version = 0;
+        Dwarf_Small table_count = 0;
+        Dwarf_Line_Context context = nullptr;
+        dwarf_error error(dbg_);
+        int res = details::call<libdwarf_call::srclines_b>(dwarf_srclines_b, handle_.get(), &version, &table_count,
+                                                           &context, error.out());
+        if (res == DW_DLV_NO_ENTRY) {
+            return {};
+        }
+        if (res != DW_DLV_OK) {
+            throw other_error("dwarf_srclines_b failed!");
+        }
+        std::unique_ptr<Dwarf_Line_Context_s, decltype(&dwarf_srclines_dealloc_b)> owner(context,
+                                                                                         dwarf_srclines_dealloc_b);
+        Dwarf_Line *lines = nullptr;
+        Dwarf_Signed count = 0;
+        if (details::call<libdwarf_call::srclines_from_linecontext>(dwarf_srclines_from_linecontext, context, &lines,
+                                                                     &count, error.out()) != DW_DLV_OK) {
+            throw other_error("dwarf_srclines_from_linecontext failed!");
+        }
+
+        // the accessors below only read the row libdwarf has already decoded
+        std::vector<line_row> rows;
+        rows.reserve(static_cast<std::size_t>(count));
+        for (Dwarf_Signed i = 0; i < count; ++i) {
+            Dwarf_Addr address = 0;
+            Dwarf_Unsigned file = 0, line = 0, column = 0;
+            Dwarf_Bool end_sequence = 0;
+            if (details::call<libdwarf_call::lineaddr>(dwarf_lineaddr, lines[i], &address, error.out()) !=
+                    DW_DLV_OK ||
+                details::call<libdwarf_call::line_srcfileno>(dwarf_line_srcfileno, lines[i], &file, error.out()) !=
+                    DW_DLV_OK ||
+                details::call<libdwarf_call::lineno>(dwarf_lineno, lines[i], &line, error.out()) != DW_DLV_OK ||
+                details::call<libdwarf_call::lineoff_b>(dwarf_lineoff_b, lines[i], &column, error.out()) !=
+                    DW_DLV_OK ||
+                details::call<libdwarf_call::lineendsequence>(dwarf_lineendsequence, lines[i], &end_sequence,
+                                                              error.out()) != DW_DLV_OK) {
+                throw other_error("reading a line table row failed!");
+            }
+            rows.push_back({address, static_cast<std::size_t>(file), static_cast<std::size_t>(line),
+                            static_cast<std::size_t>(column), end_sequence != 0});
+        }
+        return rows;
+    }
+
+    // DW_AT_low_pc, e.g. the base address of a CU DIE for address_ranges()
+    [[nodiscard]] expected<Dwarf_Addr> try_low_pc() const noexcept
+    {
+        Dwarf_Addr low = 0;
+        dwarf_error error(dbg_);
+        int res = details::call<libdwarf_call::lowpc>(dwarf_lowpc, handle_.get(), &low, error.out());
+        if (res != DW_DLV_OK) {
+            return errc_of(res);
+        }
+        return low;
+    }
+
+    // The code addresses the DIE covers, from DW_AT_low_pc and DW_AT_high_pc or from DW_AT_ranges; empty if it has
+    // neither, e.g. a declaration or an inlined-only function. DWARF 2 to 4 range lists are relative to the base
+    // address of the unit, which has to be passed as `cu_base` (DW_AT_low_pc of the CU DIE, 0 if it has none);
+    // libdwarf resolves DWARF 5 range lists itself.
+    [[nodiscard]] std::vector<address_range> address_ranges(Dwarf_Addr cu_base = 0) const
+    {
+        const auto low_pc = try_low_pc();
+        if (!low_pc && low_pc.error() == errc::dwarf_error) {
+            throw other_error("dwarf_lowpc failed!");
+        }
+        dwarf_error error(dbg_);
+        int res = DW_DLV_OK;
+        if (low_pc) {
+            const auto low = *low_pc;
+            Dwarf_Addr high = 0;
+            Dwarf_Half form = 0;
+            enum Dwarf_Form_Class form_class = DW_FORM_CLASS_UNKNOWN;
+            res = details::call<libdwarf_call::highpc_b>(dwarf_highpc_b, handle_.get(), &high, &form, &form_class,
+                                                         error.out());
+            if (res == DW_DLV_ERROR) {
+                throw other_error("dwarf_highpc_b failed!");
+            }
+            if (res == DW_DLV_OK) {
+                // since DWARF 4, DW_AT_high_pc is usually the size rather than the end
+                const auto end = form_class == DW_FORM_CLASS_CONSTANT ? low + high : high;
+                return end > low ? std::vector<address_range>{{low, end}} : std::vector<address_range>{};
+            }
+            // a CU DIE with both DW_AT_low_pc, as the base address, and DW_AT_ranges
+        }
+
+        Dwarf_Attribute attr = nullptr;
+        res = details::call<libdwarf_call::attr>(dwarf_attr, handle_.get(), Dwarf_Half{DW_AT_ranges}, &attr,
+                                                 error.out());
+        if (res == DW_DLV_NO_ENTRY) {
+            return {};
+        }
+        if (res != DW_DLV_OK) {
+            throw other_error("dwarf_attr failed!");
+        }
+        std::unique_ptr<Dwarf_Attribute_s, decltype(&dwarf_dealloc_attribute)> owner(attr, dwarf_dealloc_attribute);
+        Dwarf_Half version = 0, offset_size = 0;
+        if (details::call<libdwarf_call::get_version_of_die>(dwarf_get_version_of_die, handle_.get(), &version,
+                                                              &offset_size) != DW_DLV_OK) {
+            throw other_error("dwarf_get_version_of_die failed!");
+        }
+        return version >= 5 ? rnglist_ranges(attr) : debug_ranges(attr, cu_base);
+    }
+
     friend std::ostream &operator<<(std::ostream &os, const die &d)
     {
         os << "die: " << d.tag() << "\n";
@@ -190,54 +519,171 @@ public:
             if (i > 0) {
                 os << "\n";
             }
-            os << " [" << std::setw(2) << std::right << i << "] " << attr;
+            os << " [" << std::setw(2) << std::right << i << "] " << *attr;
         }
         return os;
     }
 
 private:
+    // DWARF 2 to 4: DW_AT_ranges is an offset into .debug_ranges
+    std::vector<address_range> debug_ranges(Dwarf_Attribute attr, Dwarf_Addr base) const
+    {
+        Dwarf_Half form = 0;
+        Dwarf_Off offset = 0;
+        Dwarf_Bool is_info = 0;
+        dwarf_error error(dbg_);
+        if (details::call<libdwarf_call::whatform>(dwarf_whatform, attr, &form, error.out()) != DW_DLV_OK) {
+            throw other_error("dwarf_whatform failed!");
+        }
+        // DW_FORM_data4 or DW_FORM_data8 before DWARF 4
+        int res = form == DW_FORM_sec_offset ? details::call<libdwarf_call::global_formref_b>(
+                                                   dwarf_global_formref_b, attr, &offset, &is_info, error.out())
+                                             : details::call<libdwarf_call::formudata>(dwarf_formudata, attr, &offset,
+                                                                                        error.out());
+        if (res != DW_DLV_OK) {
+            throw other_error("reading DW_AT_ranges failed!");
+        }
+
+        Dwarf_Ranges *entries = nullptr;
+        Dwarf_Signed count = 0;
+        Dwarf_Unsigned byte_count = 0;
+        Dwarf_Off real_offset = 0;
+        res = details::call<libdwarf_call::get_ranges_b>(dwarf_get_ranges_b, dbg_, offset, handle_.get(), &real_offset,
+                                                         &entries, &count, &byte_count, error.out());
+        if (res == DW_DLV_NO_ENTRY) {
+            return {};
+        }
+        if (res != DW_DLV_OK) {
+            throw other_error("dwarf_get_ranges_b failed!");
+        }
+        std::vector<address_range> ranges;
+        for (Dwarf_Signed i = 0; i < count; ++i) {
+            const auto &entry = entries[i];
+            if (entry.dwr_type == DW_RANGES_ADDRESS_SELECTION) {
+                base = entry.dwr_addr2;
+            }
+            else if (entry.dwr_type == DW_RANGES_ENTRY && entry.dwr_addr2 > entry.dwr_addr1) {
+                ranges.push_back({base + entry.dwr_addr1, base + entry.dwr_addr2});
+            }
+        }
+        dwarf_dealloc_ranges(dbg_, entries, count);
+        return ranges;
+    }
+
+    // DWARF 5: DW_AT_ranges is an offset into .debug_rnglists or an index into its offset table
+    std::vector<address_range> rnglist_ranges(Dwarf_Attribute attr) const
+    {
+        Dwarf_Half form = 0;
+        Dwarf_Unsigned value = 0;
+        Dwarf_Bool is_info = 0;
+        dwarf_error error(dbg_);
+        if (details::call<libdwarf_call::whatform>(dwarf_whatform, attr, &form, error.out()) != DW_DLV_OK) {
+            throw other_error("dwarf_whatform failed!");
+        }
+        int res = form == DW_FORM_rnglistx
+                      ? details::call<libdwarf_call::formudata>(dwarf_formudata, attr, &value, error.out())
+                      : details::call<libdwarf_call::global_formref_b>(dwarf_global_formref_b, attr, &value, &is_info,
+                                                                       error.out());
+        if (res != DW_DLV_OK) {
+            throw other_error("reading DW_AT_ranges failed!");
+        }
+
+        Dwarf_Rnglists_Head head = nullptr;
+        Dwarf_Unsigned count = 0;
+        Dwarf_Unsigned global_offset = 0;
+        res = details::call<libdwarf_call::rnglists_get_rle_head>(dwarf_rnglists_get_rle_head, attr, form, value, &head,
+                                                                  &count, &global_offset, error.out());
+        if (res == DW_DLV_NO_ENTRY) {
+            return {};
+        }
+        if (res != DW_DLV_OK) {
+            throw other_error("dwarf_rnglists_get_rle_head failed!");
+        }
+        std::unique_ptr<Dwarf_Rnglists_Head_s, decltype(&dwarf_dealloc_rnglists_head)> owner(
+            head, dwarf_dealloc_rnglists_head);
+        std::vector<address_range> ranges;
+        for (Dwarf_Unsigned i = 0; i < count; ++i) {
+            unsigned length = 0;
+            unsigned kind = 0;
+            Dwarf_Unsigned raw_low = 0, raw_high = 0, low = 0, high = 0;
+            Dwarf_Bool unavailable = 0;
+            if (details::call<libdwarf_call::get_rnglists_entry_fields_a>(dwarf_get_rnglists_entry_fields_a, head, i,
+                                                                          &length, &kind, &raw_low, &raw_high,
+                                                                          &unavailable, &low, &high,
+                                                                          error.out()) != DW_DLV_OK) {
+                throw other_error("dwarf_get_rnglists_entry_fields_a failed!");
+            }
+            if (kind == DW_RLE_end_of_list) {
+                break;
+            }
+            // base address entries are already applied to the cooked values of the entries after them
+            if (!unavailable && kind != DW_RLE_base_address && kind != DW_RLE_base_addressx && high > low) {
+                ranges.push_back({low, high});
+            }
+        }
+        return ranges;
+    }
+
+    template <attribute_t... Types, typename Tuple, std::size_t... Indices>
+    void read_into(Dwarf_Attribute attr, Tuple &result, std::index_sequence<Indices...>) const
+    {
+        Dwarf_Half attr_num = 0;
+        dwarf_error error(dbg_);
+        if (details::call<libdwarf_call::whatattr>(dwarf_whatattr, attr, &attr_num, error.out()) != DW_DLV_OK) {
+            throw other_error("dwarf_whatattr failed!");
+        }
+        // the form is only decoded for the requested attributes, the dispatch on the value type is resolved at compile
+        // time
+        ((attr_num == static_cast<Dwarf_Half>(Types)
+              ? static_cast<void>(std::get<Indices>(result) = decode_attribute<kind_of(Types)>(dbg_, attr))
+              : static_cast<void>(0)),
+         ...);
+    }
+
     Dwarf_Debug dbg_ = nullptr;
     handle_t handle_;
     bool is_info_;
-    std::unique_ptr<attribute_list> attributes_;
+    mutable arena_ptr<attribute_list> attributes_;
 };
 
 template <>
-inline std::unique_ptr<die> attribute::get<std::unique_ptr<die>>() const
+inline expected<die> attribute::try_get<die>() const
 {
+    if (class_of(try_form().value_or(cppdwarf::form{})) != form_class::reference) {
+        return errc::type_mismatch;
+    }
     Dwarf_Off offset = 0;
     Dwarf_Bool is_info = 0;
-    Dwarf_Error error = nullptr;
-    int res = dwarf_global_formref_b(handle_.get(), &offset, &is_info, &error);
+    dwarf_error error(dbg_);
+    int res = details::call<libdwarf_call::global_formref_b>(dwarf_global_formref_b, handle_.get(), &offset, &is_info,
+                                                             error.out());
     if (res != DW_DLV_OK) {
-        throw other_error("dwarf_global_formref failed!");
+        return errc_of(res);
     }
 
-    Dwarf_Die die;
-    res = dwarf_offdie_b(dbg_, offset, is_info, &die, &error);
+    Dwarf_Die die = nullptr;
+    res = details::call<libdwarf_call::offdie_b>(dwarf_offdie_b, dbg_, offset, is_info, &die, error.out());
     if (res != DW_DLV_OK) {
-        throw other_error("dwarf_offdie_b failed!");
+        return errc_of(res);
     }
-    return std::make_unique<cppdwarf::die>(dbg_, die, is_info);
+    details::count(details::counter::reference_resolutions);
+    return cppdwarf::die(dbg_, die, is_info);
 }
 
 template <>
 inline die attribute::get<die>() const
 {
-    Dwarf_Off offset = 0;
-    Dwarf_Bool is_info = 0;
-    Dwarf_Error error = nullptr;
-    int res = dwarf_global_formref_b(handle_.get(), &offset, &is_info, &error);
-    if (res != DW_DLV_OK) {
-        throw other_error("dwarf_global_formref failed!");
+    auto die = try_get<cppdwarf::die>();
+    if (!die) {
+        throw other_error(die.error() == errc::type_mismatch ? "not a reference" : "dwarf_offdie_b failed!");
     }
+    return std::move(*die);
+}
 
-    Dwarf_Die die;
-    res = dwarf_offdie_b(dbg_, offset, is_info, &die, &error);
-    if (res != DW_DLV_OK) {
-        throw other_error("dwarf_offdie_b failed!");
-    }
-    return cppdwarf::die(dbg_, die, is_info);
+template <>
+inline std::unique_ptr<die> attribute::get<std::unique_ptr<die>>() const
+{
+    return std::make_unique<cppdwarf::die>(get<die>());
 }
 
 } // namespace cppdwarf
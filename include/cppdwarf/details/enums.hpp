@@ -3,10 +3,57 @@
 #include <dwarf.h>
 #include <libdwarf.h>
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
 #include <ostream>
+#include <string_view>
 
 namespace cppdwarf {
 
+namespace details {
+template <typename Enum>
+struct enum_entry {
+    Enum value;
+    std::string_view name;
+};
+
+// Sorts a generated table by value at compile time. The sort is stable: where dwarf.h defines several names for the
+// same value, the first one is kept in front, which is the name dwarf_get_*_name() returns.
+template <typename Entry, std::size_t N>
+constexpr std::array<Entry, N> sort_by_value(const Entry (&entries)[N])
+{
+    std::array<Entry, N> table{};
+    for (std::size_t i = 0; i < N; ++i) {
+        auto j = i;
+        for (; j > 0 && entries[i].value < table[j - 1].value; --j) {
+            table[j] = table[j - 1];
+        }
+        table[j] = entries[i];
+    }
+    return table;
+}
+
+template <typename Entry, std::size_t N, typename Enum>
+constexpr const Entry *find_entry(const std::array<Entry, N> &table, Enum value)
+{
+    std::size_t first = 0;
+    std::size_t count = N;
+    while (count > 0) {
+        const auto step = count / 2;
+        if (table[first + step].value < value) {
+            first += step + 1;
+            count -= step + 1;
+        }
+        else {
+            count = step;
+        }
+    }
+    return first < N && table[first].value == value ? &table[first] : nullptr;
+}
+} // namespace details
+
 enum class access {
     public_ = DW_ACCESS_public,
     protected_ = DW_ACCESS_protected,
@@ -77,11 +124,109 @@ enum class form {
     LLVM_addrx_offset = DW_FORM_LLVM_addrx_offset,
 };
 
+// The class a form's value belongs to (DWARF 5 section 7.5.5). Offsets into other sections, whether direct or
+// through an index, share section_offset.
+enum class form_class {
+    unknown,
+    address,
+    block,
+    constant,
+    exprloc,
+    flag,
+    indirect,
+    reference,
+    section_offset,
+    string,
+};
+
+namespace details {
+struct form_entry {
+    form value;
+    std::string_view name;
+    form_class class_;
+    std::int8_t size; // -1 if variable-length or dependent on the unit's address or offset size
+};
+} // namespace details
+
+namespace details {
+inline constexpr auto form_table = sort_by_value<form_entry>({
+    {form::addr, "DW_FORM_addr", form_class::address, -1},
+    {form::block2, "DW_FORM_block2", form_class::block, -1},
+    {form::block4, "DW_FORM_block4", form_class::block, -1},
+    {form::data2, "DW_FORM_data2", form_class::constant, 2},
+    {form::data4, "DW_FORM_data4", form_class::constant, 4},
+    {form::data8, "DW_FORM_data8", form_class::constant, 8},
+    {form::string, "DW_FORM_string", form_class::string, -1},
+    {form::block, "DW_FORM_block", form_class::block, -1},
+    {form::block1, "DW_FORM_block1", form_class::block, -1},
+    {form::data1, "DW_FORM_data1", form_class::constant, 1},
+    {form::flag, "DW_FORM_flag", form_class::flag, 1},
+    {form::sdata, "DW_FORM_sdata", form_class::constant, -1},
+    {form::strp, "DW_FORM_strp", form_class::string, -1},
+    {form::udata, "DW_FORM_udata", form_class::constant, -1},
+    {form::ref_addr, "DW_FORM_ref_addr", form_class::reference, -1},
+    {form::ref1, "DW_FORM_ref1", form_class::reference, 1},
+    {form::ref2, "DW_FORM_ref2", form_class::reference, 2},
+    {form::ref4, "DW_FORM_ref4", form_class::reference, 4},
+    {form::ref8, "DW_FORM_ref8", form_class::reference, 8},
+    {form::ref_udata, "DW_FORM_ref_udata", form_class::reference, -1},
+    {form::indirect, "DW_FORM_indirect", form_class::indirect, -1},
+    {form::sec_offset, "DW_FORM_sec_offset", form_class::section_offset, -1},
+    {form::exprloc, "DW_FORM_exprloc", form_class::exprloc, -1},
+    {form::flag_present, "DW_FORM_flag_present", form_class::flag, 0},
+    {form::strx, "DW_FORM_strx", form_class::string, -1},
+    {form::addrx, "DW_FORM_addrx", form_class::address, -1},
+    {form::ref_sup4, "DW_FORM_ref_sup4", form_class::reference, 4},
+    {form::strp_sup, "DW_FORM_strp_sup", form_class::string, -1},
+    {form::data16, "DW_FORM_data16", form_class::constant, 16},
+    {form::line_strp, "DW_FORM_line_strp", form_class::string, -1},
+    {form::ref_sig8, "DW_FORM_ref_sig8", form_class::reference, 8},
+    {form::implicit_const, "DW_FORM_implicit_const", form_class::constant, 0},
+    {form::loclistx, "DW_FORM_loclistx", form_class::section_offset, -1},
+    {form::rnglistx, "DW_FORM_rnglistx", form_class::section_offset, -1},
+    {form::ref_sup8, "DW_FORM_ref_sup8", form_class::reference, 8},
+    {form::strx1, "DW_FORM_strx1", form_class::string, 1},
+    {form::strx2, "DW_FORM_strx2", form_class::string, 2},
+    {form::strx3, "DW_FORM_strx3", form_class::string, 3},
+    {form::strx4, "DW_FORM_strx4", form_class::string, 4},
+    {form::addrx1, "DW_FORM_addrx1", form_class::address, 1},
+    {form::addrx2, "DW_FORM_addrx2", form_class::address, 2},
+    {form::addrx3, "DW_FORM_addrx3", form_class::address, 3},
+    {form::addrx4, "DW_FORM_addrx4", form_class::address, 4},
+    {form::GNU_addr_index, "DW_FORM_GNU_addr_index", form_class::address, -1},
+    {form::GNU_str_index, "DW_FORM_GNU_str_index", form_class::string, -1},
+    {form::GNU_ref_alt, "DW_FORM_GNU_ref_alt", form_class::reference, -1},
+    {form::GNU_strp_alt, "DW_FORM_GNU_strp_alt", form_class::string, -1},
+    {form::LLVM_addrx_offset, "DW_FORM_LLVM_addrx_offset", form_class::address, -1},
+});
+} // namespace details
+
+constexpr std::string_view to_string(form f)
+{
+    const auto *entry = details::find_entry(details::form_table, f);
+    return entry ? entry->name : std::string_view();
+}
+
+constexpr form_class class_of(form f)
+{
+    const auto *entry = details::find_entry(details::form_table, f);
+    return entry ? entry->class_ : form_class::unknown;
+}
+
+// number of bytes a value of this form takes in the DIE, std::nullopt if that depends on the value or the unit
+constexpr std::optional<std::size_t> fixed_size(form f)
+{
+    const auto *entry = details::find_entry(details::form_table, f);
+    if (!entry || entry->size < 0) {
+        return std::nullopt;
+    }
+    return static_cast<std::size_t>(entry->size);
+}
+
 inline std::ostream &operator<<(std::ostream &os, form f)
 {
-    const char *name = nullptr;
-    int res = dwarf_get_FORM_name(static_cast<Dwarf_Half>(f), &name);
-    if (res != DW_DLV_OK) {
+    const auto name = to_string(f);
+    if (name.empty()) {
         os << "<bogus form>";
     }
     else {
@@ -219,11 +364,147 @@ enum class tag {
     hi_user = DW_TAG_hi_user,
 };
 
+namespace details {
+inline constexpr auto tag_names = sort_by_value<enum_entry<tag>>({
+    {tag::array_type, "DW_TAG_array_type"},
+    {tag::class_type, "DW_TAG_class_type"},
+    {tag::entry_point, "DW_TAG_entry_point"},
+    {tag::enumeration_type, "DW_TAG_enumeration_type"},
+    {tag::formal_parameter, "DW_TAG_formal_parameter"},
+    {tag::imported_declaration, "DW_TAG_imported_declaration"},
+    {tag::label, "DW_TAG_label"},
+    {tag::lexical_block, "DW_TAG_lexical_block"},
+    {tag::member, "DW_TAG_member"},
+    {tag::pointer_type, "DW_TAG_pointer_type"},
+    {tag::reference_type, "DW_TAG_reference_type"},
+    {tag::compile_unit, "DW_TAG_compile_unit"},
+    {tag::string_type, "DW_TAG_string_type"},
+    {tag::structure_type, "DW_TAG_structure_type"},
+    {tag::subroutine_type, "DW_TAG_subroutine_type"},
+    {tag::typedef_, "DW_TAG_typedef"},
+    {tag::union_type, "DW_TAG_union_type"},
+    {tag::unspecified_parameters, "DW_TAG_unspecified_parameters"},
+    {tag::variant, "DW_TAG_variant"},
+    {tag::common_block, "DW_TAG_common_block"},
+    {tag::common_inclusion, "DW_TAG_common_inclusion"},
+    {tag::inheritance, "DW_TAG_inheritance"},
+    {tag::inlined_subroutine, "DW_TAG_inlined_subroutine"},
+    {tag::module, "DW_TAG_module"},
+    {tag::ptr_to_member_type, "DW_TAG_ptr_to_member_type"},
+    {tag::set_type, "DW_TAG_set_type"},
+    {tag::subrange_type, "DW_TAG_subrange_type"},
+    {tag::with_stmt, "DW_TAG_with_stmt"},
+    {tag::access_declaration, "DW_TAG_access_declaration"},
+    {tag::base_type, "DW_TAG_base_type"},
+    {tag::catch_block, "DW_TAG_catch_block"},
+    {tag::const_type, "DW_TAG_const_type"},
+    {tag::constant, "DW_TAG_constant"},
+    {tag::enumerator, "DW_TAG_enumerator"},
+    {tag::file_type, "DW_TAG_file_type"},
+    {tag::friend_, "DW_TAG_friend"},
+    {tag::namelist, "DW_TAG_namelist"},
+    {tag::namelist_item, "DW_TAG_namelist_item"},
+    {tag::namelist_items, "DW_TAG_namelist_items"},
+    {tag::packed_type, "DW_TAG_packed_type"},
+    {tag::subprogram, "DW_TAG_subprogram"},
+    {tag::template_type_parameter, "DW_TAG_template_type_parameter"},
+    {tag::template_type_param, "DW_TAG_template_type_param"},
+    {tag::template_value_parameter, "DW_TAG_template_value_parameter"},
+    {tag::template_value_param, "DW_TAG_template_value_param"},
+    {tag::thrown_type, "DW_TAG_thrown_type"},
+    {tag::try_block, "DW_TAG_try_block"},
+    {tag::variant_part, "DW_TAG_variant_part"},
+    {tag::variable, "DW_TAG_variable"},
+    {tag::volatile_type, "DW_TAG_volatile_type"},
+    {tag::dwarf_procedure, "DW_TAG_dwarf_procedure"},
+    {tag::restrict_type, "DW_TAG_restrict_type"},
+    {tag::interface_type, "DW_TAG_interface_type"},
+    {tag::namespace_, "DW_TAG_namespace"},
+    {tag::imported_module, "DW_TAG_imported_module"},
+    {tag::unspecified_type, "DW_TAG_unspecified_type"},
+    {tag::partial_unit, "DW_TAG_partial_unit"},
+    {tag::imported_unit, "DW_TAG_imported_unit"},
+    {tag::mutable_type, "DW_TAG_mutable_type"},
+    {tag::condition, "DW_TAG_condition"},
+    {tag::shared_type, "DW_TAG_shared_type"},
+    {tag::type_unit, "DW_TAG_type_unit"},
+    {tag::rvalue_reference_type, "DW_TAG_rvalue_reference_type"},
+    {tag::template_alias, "DW_TAG_template_alias"},
+    {tag::coarray_type, "DW_TAG_coarray_type"},
+    {tag::generic_subrange, "DW_TAG_generic_subrange"},
+    {tag::dynamic_type, "DW_TAG_dynamic_type"},
+    {tag::atomic_type, "DW_TAG_atomic_type"},
+    {tag::call_site, "DW_TAG_call_site"},
+    {tag::call_site_parameter, "DW_TAG_call_site_parameter"},
+    {tag::skeleton_unit, "DW_TAG_skeleton_unit"},
+    {tag::immutable_type, "DW_TAG_immutable_type"},
+    {tag::TI_far_type, "DW_TAG_TI_far_type"},
+    {tag::lo_user, "DW_TAG_lo_user"},
+    {tag::MIPS_loop, "DW_TAG_MIPS_loop"},
+    {tag::TI_near_type, "DW_TAG_TI_near_type"},
+    {tag::TI_assign_register, "DW_TAG_TI_assign_register"},
+    {tag::TI_ioport_type, "DW_TAG_TI_ioport_type"},
+    {tag::TI_restrict_type, "DW_TAG_TI_restrict_type"},
+    {tag::TI_onchip_type, "DW_TAG_TI_onchip_type"},
+    {tag::HP_array_descriptor, "DW_TAG_HP_array_descriptor"},
+    {tag::format_label, "DW_TAG_format_label"},
+    {tag::function_template, "DW_TAG_function_template"},
+    {tag::class_template, "DW_TAG_class_template"},
+    {tag::GNU_BINCL, "DW_TAG_GNU_BINCL"},
+    {tag::GNU_EINCL, "DW_TAG_GNU_EINCL"},
+    {tag::GNU_template_template_parameter, "DW_TAG_GNU_template_template_parameter"},
+    {tag::GNU_template_template_param, "DW_TAG_GNU_template_template_param"},
+    {tag::GNU_template_parameter_pack, "DW_TAG_GNU_template_parameter_pack"},
+    {tag::GNU_formal_parameter_pack, "DW_TAG_GNU_formal_parameter_pack"},
+    {tag::GNU_call_site, "DW_TAG_GNU_call_site"},
+    {tag::GNU_call_site_parameter, "DW_TAG_GNU_call_site_parameter"},
+    {tag::SUN_function_template, "DW_TAG_SUN_function_template"},
+    {tag::SUN_class_template, "DW_TAG_SUN_class_template"},
+    {tag::SUN_struct_template, "DW_TAG_SUN_struct_template"},
+    {tag::SUN_union_template, "DW_TAG_SUN_union_template"},
+    {tag::SUN_indirect_inheritance, "DW_TAG_SUN_indirect_inheritance"},
+    {tag::SUN_codeflags, "DW_TAG_SUN_codeflags"},
+    {tag::SUN_memop_info, "DW_TAG_SUN_memop_info"},
+    {tag::SUN_omp_child_func, "DW_TAG_SUN_omp_child_func"},
+    {tag::SUN_rtti_descriptor, "DW_TAG_SUN_rtti_descriptor"},
+    {tag::SUN_dtor_info, "DW_TAG_SUN_dtor_info"},
+    {tag::SUN_dtor, "DW_TAG_SUN_dtor"},
+    {tag::SUN_f90_interface, "DW_TAG_SUN_f90_interface"},
+    {tag::SUN_fortran_vax_structure, "DW_TAG_SUN_fortran_vax_structure"},
+    {tag::SUN_hi, "DW_TAG_SUN_hi"},
+    {tag::ALTIUM_circ_type, "DW_TAG_ALTIUM_circ_type"},
+    {tag::ALTIUM_mwa_circ_type, "DW_TAG_ALTIUM_mwa_circ_type"},
+    {tag::ALTIUM_rev_carry_type, "DW_TAG_ALTIUM_rev_carry_type"},
+    {tag::ALTIUM_rom, "DW_TAG_ALTIUM_rom"},
+    {tag::LLVM_annotation, "DW_TAG_LLVM_annotation"},
+    {tag::ghs_namespace, "DW_TAG_ghs_namespace"},
+    {tag::ghs_using_namespace, "DW_TAG_ghs_using_namespace"},
+    {tag::ghs_using_declaration, "DW_TAG_ghs_using_declaration"},
+    {tag::ghs_template_templ_param, "DW_TAG_ghs_template_templ_param"},
+    {tag::upc_shared_type, "DW_TAG_upc_shared_type"},
+    {tag::upc_strict_type, "DW_TAG_upc_strict_type"},
+    {tag::upc_relaxed_type, "DW_TAG_upc_relaxed_type"},
+    {tag::PGI_kanji_type, "DW_TAG_PGI_kanji_type"},
+    {tag::PGI_interface_block, "DW_TAG_PGI_interface_block"},
+    {tag::BORLAND_property, "DW_TAG_BORLAND_property"},
+    {tag::BORLAND_Delphi_string, "DW_TAG_BORLAND_Delphi_string"},
+    {tag::BORLAND_Delphi_dynamic_array, "DW_TAG_BORLAND_Delphi_dynamic_array"},
+    {tag::BORLAND_Delphi_set, "DW_TAG_BORLAND_Delphi_set"},
+    {tag::BORLAND_Delphi_variant, "DW_TAG_BORLAND_Delphi_variant"},
+    {tag::hi_user, "DW_TAG_hi_user"},
+});
+} // namespace details
+
+constexpr std::string_view to_string(tag tag)
+{
+    const auto *entry = details::find_entry(details::tag_names, tag);
+    return entry ? entry->name : std::string_view();
+}
+
 inline std::ostream &operator<<(std::ostream &os, tag tag)
 {
-    const char *name = nullptr;
-    int res = dwarf_get_TAG_name(static_cast<Dwarf_Half>(tag), &name);
-    if (res != DW_DLV_OK) {
+    const auto name = to_string(tag);
+    if (name.empty()) {
         os << "<bogus tag>";
     }
     else {
@@ -586,11 +867,353 @@ enum class attribute_t {
     hi_user = DW_AT_hi_user,
 };
 
+namespace details {
+inline constexpr auto attribute_t_names = sort_by_value<enum_entry<attribute_t>>({
+    {attribute_t::sibling, "DW_AT_sibling"},
+    {attribute_t::location, "DW_AT_location"},
+    {attribute_t::name, "DW_AT_name"},
+    {attribute_t::ordering, "DW_AT_ordering"},
+    {attribute_t::subscr_data, "DW_AT_subscr_data"},
+    {attribute_t::byte_size, "DW_AT_byte_size"},
+    {attribute_t::bit_offset, "DW_AT_bit_offset"},
+    {attribute_t::bit_size, "DW_AT_bit_size"},
+    {attribute_t::element_list, "DW_AT_element_list"},
+    {attribute_t::stmt_list, "DW_AT_stmt_list"},
+    {attribute_t::low_pc, "DW_AT_low_pc"},
+    {attribute_t::high_pc, "DW_AT_high_pc"},
+    {attribute_t::language, "DW_AT_language"},
+    {attribute_t::member, "DW_AT_member"},
+    {attribute_t::discr, "DW_AT_discr"},
+    {attribute_t::discr_value, "DW_AT_discr_value"},
+    {attribute_t::visibility, "DW_AT_visibility"},
+    {attribute_t::import, "DW_AT_import"},
+    {attribute_t::string_length, "DW_AT_string_length"},
+    {attribute_t::common_reference, "DW_AT_common_reference"},
+    {attribute_t::comp_dir, "DW_AT_comp_dir"},
+    {attribute_t::const_value, "DW_AT_const_value"},
+    {attribute_t::containing_type, "DW_AT_containing_type"},
+    {attribute_t::default_value, "DW_AT_default_value"},
+    {attribute_t::inline_, "DW_AT_inline"},
+    {attribute_t::is_optional, "DW_AT_is_optional"},
+    {attribute_t::lower_bound, "DW_AT_lower_bound"},
+    {attribute_t::producer, "DW_AT_producer"},
+    {attribute_t::prototyped, "DW_AT_prototyped"},
+    {attribute_t::return_addr, "DW_AT_return_addr"},
+    {attribute_t::start_scope, "DW_AT_start_scope"},
+    {attribute_t::bit_stride, "DW_AT_bit_stride"},
+    {attribute_t::stride_size, "DW_AT_stride_size"},
+    {attribute_t::upper_bound, "DW_AT_upper_bound"},
+    {attribute_t::abstract_origin, "DW_AT_abstract_origin"},
+    {attribute_t::accessibility, "DW_AT_accessibility"},
+    {attribute_t::address_class, "DW_AT_address_class"},
+    {attribute_t::artificial, "DW_AT_artificial"},
+    {attribute_t::base_types, "DW_AT_base_types"},
+    {attribute_t::calling_convention, "DW_AT_calling_convention"},
+    {attribute_t::count, "DW_AT_count"},
+    {attribute_t::data_member_location, "DW_AT_data_member_location"},
+    {attribute_t::decl_column, "DW_AT_decl_column"},
+    {attribute_t::decl_file, "DW_AT_decl_file"},
+    {attribute_t::decl_line, "DW_AT_decl_line"},
+    {attribute_t::declaration, "DW_AT_declaration"},
+    {attribute_t::discr_list, "DW_AT_discr_list"},
+    {attribute_t::encoding, "DW_AT_encoding"},
+    {attribute_t::external, "DW_AT_external"},
+    {attribute_t::frame_base, "DW_AT_frame_base"},
+    {attribute_t::friend_, "DW_AT_friend"},
+    {attribute_t::identifier_case, "DW_AT_identifier_case"},
+    {attribute_t::macro_info, "DW_AT_macro_info"},
+    {attribute_t::namelist_item, "DW_AT_namelist_item"},
+    {attribute_t::priority, "DW_AT_priority"},
+    {attribute_t::segment, "DW_AT_segment"},
+    {attribute_t::specification, "DW_AT_specification"},
+    {attribute_t::static_link, "DW_AT_static_link"},
+    {attribute_t::type, "DW_AT_type"},
+    {attribute_t::use_location, "DW_AT_use_location"},
+    {attribute_t::variable_parameter, "DW_AT_variable_parameter"},
+    {attribute_t::virtuality, "DW_AT_virtuality"},
+    {attribute_t::vtable_elem_location, "DW_AT_vtable_elem_location"},
+    {attribute_t::allocated, "DW_AT_allocated"},
+    {attribute_t::associated, "DW_AT_associated"},
+    {attribute_t::data_location, "DW_AT_data_location"},
+    {attribute_t::byte_stride, "DW_AT_byte_stride"},
+    {attribute_t::stride, "DW_AT_stride"},
+    {attribute_t::entry_pc, "DW_AT_entry_pc"},
+    {attribute_t::use_UTF8, "DW_AT_use_UTF8"},
+    {attribute_t::extension, "DW_AT_extension"},
+    {attribute_t::ranges, "DW_AT_ranges"},
+    {attribute_t::trampoline, "DW_AT_trampoline"},
+    {attribute_t::call_column, "DW_AT_call_column"},
+    {attribute_t::call_file, "DW_AT_call_file"},
+    {attribute_t::call_line, "DW_AT_call_line"},
+    {attribute_t::description, "DW_AT_description"},
+    {attribute_t::binary_scale, "DW_AT_binary_scale"},
+    {attribute_t::decimal_scale, "DW_AT_decimal_scale"},
+    {attribute_t::small, "DW_AT_small"},
+    {attribute_t::decimal_sign, "DW_AT_decimal_sign"},
+    {attribute_t::digit_count, "DW_AT_digit_count"},
+    {attribute_t::picture_string, "DW_AT_picture_string"},
+    {attribute_t::mutable_, "DW_AT_mutable"},
+    {attribute_t::threads_scaled, "DW_AT_threads_scaled"},
+    {attribute_t::explicit_, "DW_AT_explicit"},
+    {attribute_t::object_pointer, "DW_AT_object_pointer"},
+    {attribute_t::endianity, "DW_AT_endianity"},
+    {attribute_t::elemental, "DW_AT_elemental"},
+    {attribute_t::pure, "DW_AT_pure"},
+    {attribute_t::recursive, "DW_AT_recursive"},
+    {attribute_t::signature, "DW_AT_signature"},
+    {attribute_t::main_subprogram, "DW_AT_main_subprogram"},
+    {attribute_t::data_bit_offset, "DW_AT_data_bit_offset"},
+    {attribute_t::const_expr, "DW_AT_const_expr"},
+    {attribute_t::enum_class, "DW_AT_enum_class"},
+    {attribute_t::linkage_name, "DW_AT_linkage_name"},
+    {attribute_t::string_length_bit_size, "DW_AT_string_length_bit_size"},
+    {attribute_t::string_length_byte_size, "DW_AT_string_length_byte_size"},
+    {attribute_t::rank, "DW_AT_rank"},
+    {attribute_t::str_offsets_base, "DW_AT_str_offsets_base"},
+    {attribute_t::addr_base, "DW_AT_addr_base"},
+    {attribute_t::rnglists_base, "DW_AT_rnglists_base"},
+    {attribute_t::dwo_id, "DW_AT_dwo_id"},
+    {attribute_t::dwo_name, "DW_AT_dwo_name"},
+    {attribute_t::reference, "DW_AT_reference"},
+    {attribute_t::rvalue_reference, "DW_AT_rvalue_reference"},
+    {attribute_t::macros, "DW_AT_macros"},
+    {attribute_t::call_all_calls, "DW_AT_call_all_calls"},
+    {attribute_t::call_all_source_calls, "DW_AT_call_all_source_calls"},
+    {attribute_t::call_all_tail_calls, "DW_AT_call_all_tail_calls"},
+    {attribute_t::call_return_pc, "DW_AT_call_return_pc"},
+    {attribute_t::call_value, "DW_AT_call_value"},
+    {attribute_t::call_origin, "DW_AT_call_origin"},
+    {attribute_t::call_parameter, "DW_AT_call_parameter"},
+    {attribute_t::call_pc, "DW_AT_call_pc"},
+    {attribute_t::call_tail_call, "DW_AT_call_tail_call"},
+    {attribute_t::call_target, "DW_AT_call_target"},
+    {attribute_t::call_target_clobbered, "DW_AT_call_target_clobbered"},
+    {attribute_t::call_data_location, "DW_AT_call_data_location"},
+    {attribute_t::call_data_value, "DW_AT_call_data_value"},
+    {attribute_t::noreturn, "DW_AT_noreturn"},
+    {attribute_t::alignment, "DW_AT_alignment"},
+    {attribute_t::export_symbols, "DW_AT_export_symbols"},
+    {attribute_t::deleted, "DW_AT_deleted"},
+    {attribute_t::defaulted, "DW_AT_defaulted"},
+    {attribute_t::loclists_base, "DW_AT_loclists_base"},
+    {attribute_t::ghs_namespace_alias, "DW_AT_ghs_namespace_alias"},
+    {attribute_t::ghs_using_namespace, "DW_AT_ghs_using_namespace"},
+    {attribute_t::ghs_using_declaration, "DW_AT_ghs_using_declaration"},
+    {attribute_t::HP_block_index, "DW_AT_HP_block_index"},
+    {attribute_t::lo_user, "DW_AT_lo_user"},
+    {attribute_t::TI_veneer, "DW_AT_TI_veneer"},
+    {attribute_t::MIPS_fde, "DW_AT_MIPS_fde"},
+    {attribute_t::TI_symbol_name, "DW_AT_TI_symbol_name"},
+    {attribute_t::MIPS_loop_begin, "DW_AT_MIPS_loop_begin"},
+    {attribute_t::MIPS_tail_loop_begin, "DW_AT_MIPS_tail_loop_begin"},
+    {attribute_t::MIPS_epilog_begin, "DW_AT_MIPS_epilog_begin"},
+    {attribute_t::MIPS_loop_unroll_factor, "DW_AT_MIPS_loop_unroll_factor"},
+    {attribute_t::MIPS_software_pipeline_depth, "DW_AT_MIPS_software_pipeline_depth"},
+    {attribute_t::MIPS_linkage_name, "DW_AT_MIPS_linkage_name"},
+    {attribute_t::MIPS_stride, "DW_AT_MIPS_stride"},
+    {attribute_t::MIPS_abstract_name, "DW_AT_MIPS_abstract_name"},
+    {attribute_t::MIPS_clone_origin, "DW_AT_MIPS_clone_origin"},
+    {attribute_t::MIPS_has_inlines, "DW_AT_MIPS_has_inlines"},
+    {attribute_t::TI_version, "DW_AT_TI_version"},
+    {attribute_t::MIPS_stride_byte, "DW_AT_MIPS_stride_byte"},
+    {attribute_t::TI_asm, "DW_AT_TI_asm"},
+    {attribute_t::MIPS_stride_elem, "DW_AT_MIPS_stride_elem"},
+    {attribute_t::MIPS_ptr_dopetype, "DW_AT_MIPS_ptr_dopetype"},
+    {attribute_t::TI_skeletal, "DW_AT_TI_skeletal"},
+    {attribute_t::MIPS_allocatable_dopetype, "DW_AT_MIPS_allocatable_dopetype"},
+    {attribute_t::MIPS_assumed_shape_dopetype, "DW_AT_MIPS_assumed_shape_dopetype"},
+    {attribute_t::MIPS_assumed_size, "DW_AT_MIPS_assumed_size"},
+    {attribute_t::TI_interrupt, "DW_AT_TI_interrupt"},
+    {attribute_t::HP_unmodifiable, "DW_AT_HP_unmodifiable"},
+    {attribute_t::HP_prologue, "DW_AT_HP_prologue"},
+    {attribute_t::HP_epilogue, "DW_AT_HP_epilogue"},
+    {attribute_t::HP_actuals_stmt_list, "DW_AT_HP_actuals_stmt_list"},
+    {attribute_t::HP_proc_per_section, "DW_AT_HP_proc_per_section"},
+    {attribute_t::HP_raw_data_ptr, "DW_AT_HP_raw_data_ptr"},
+    {attribute_t::HP_pass_by_reference, "DW_AT_HP_pass_by_reference"},
+    {attribute_t::HP_opt_level, "DW_AT_HP_opt_level"},
+    {attribute_t::HP_prof_version_id, "DW_AT_HP_prof_version_id"},
+    {attribute_t::HP_opt_flags, "DW_AT_HP_opt_flags"},
+    {attribute_t::HP_cold_region_low_pc, "DW_AT_HP_cold_region_low_pc"},
+    {attribute_t::HP_cold_region_high_pc, "DW_AT_HP_cold_region_high_pc"},
+    {attribute_t::HP_all_variables_modifiable, "DW_AT_HP_all_variables_modifiable"},
+    {attribute_t::HP_linkage_name, "DW_AT_HP_linkage_name"},
+    {attribute_t::HP_prof_flags, "DW_AT_HP_prof_flags"},
+    {attribute_t::HP_unit_name, "DW_AT_HP_unit_name"},
+    {attribute_t::HP_unit_size, "DW_AT_HP_unit_size"},
+    {attribute_t::HP_widened_byte_size, "DW_AT_HP_widened_byte_size"},
+    {attribute_t::HP_definition_points, "DW_AT_HP_definition_points"},
+    {attribute_t::HP_default_location, "DW_AT_HP_default_location"},
+    {attribute_t::HP_is_result_param, "DW_AT_HP_is_result_param"},
+    {attribute_t::CPQ_discontig_ranges, "DW_AT_CPQ_discontig_ranges"},
+    {attribute_t::CPQ_semantic_events, "DW_AT_CPQ_semantic_events"},
+    {attribute_t::CPQ_split_lifetimes_var, "DW_AT_CPQ_split_lifetimes_var"},
+    {attribute_t::CPQ_split_lifetimes_rtn, "DW_AT_CPQ_split_lifetimes_rtn"},
+    {attribute_t::CPQ_prologue_length, "DW_AT_CPQ_prologue_length"},
+    {attribute_t::ghs_mangled, "DW_AT_ghs_mangled"},
+    {attribute_t::ghs_rsm, "DW_AT_ghs_rsm"},
+    {attribute_t::ghs_frsm, "DW_AT_ghs_frsm"},
+    {attribute_t::ghs_frames, "DW_AT_ghs_frames"},
+    {attribute_t::ghs_rso, "DW_AT_ghs_rso"},
+    {attribute_t::ghs_subcpu, "DW_AT_ghs_subcpu"},
+    {attribute_t::ghs_lbrace_line, "DW_AT_ghs_lbrace_line"},
+    {attribute_t::INTEL_other_endian, "DW_AT_INTEL_other_endian"},
+    {attribute_t::sf_names, "DW_AT_sf_names"},
+    {attribute_t::src_info, "DW_AT_src_info"},
+    {attribute_t::mac_info, "DW_AT_mac_info"},
+    {attribute_t::src_coords, "DW_AT_src_coords"},
+    {attribute_t::body_begin, "DW_AT_body_begin"},
+    {attribute_t::body_end, "DW_AT_body_end"},
+    {attribute_t::GNU_vector, "DW_AT_GNU_vector"},
+    {attribute_t::GNU_guarded_by, "DW_AT_GNU_guarded_by"},
+    {attribute_t::GNU_pt_guarded_by, "DW_AT_GNU_pt_guarded_by"},
+    {attribute_t::GNU_guarded, "DW_AT_GNU_guarded"},
+    {attribute_t::GNU_pt_guarded, "DW_AT_GNU_pt_guarded"},
+    {attribute_t::GNU_locks_excluded, "DW_AT_GNU_locks_excluded"},
+    {attribute_t::GNU_exclusive_locks_required, "DW_AT_GNU_exclusive_locks_required"},
+    {attribute_t::GNU_shared_locks_required, "DW_AT_GNU_shared_locks_required"},
+    {attribute_t::GNU_odr_signature, "DW_AT_GNU_odr_signature"},
+    {attribute_t::GNU_template_name, "DW_AT_GNU_template_name"},
+    {attribute_t::GNU_call_site_value, "DW_AT_GNU_call_site_value"},
+    {attribute_t::GNU_call_site_data_value, "DW_AT_GNU_call_site_data_value"},
+    {attribute_t::GNU_call_site_target, "DW_AT_GNU_call_site_target"},
+    {attribute_t::GNU_call_site_target_clobbered, "DW_AT_GNU_call_site_target_clobbered"},
+    {attribute_t::GNU_tail_call, "DW_AT_GNU_tail_call"},
+    {attribute_t::GNU_all_tail_call_sites, "DW_AT_GNU_all_tail_call_sites"},
+    {attribute_t::GNU_all_call_sites, "DW_AT_GNU_all_call_sites"},
+    {attribute_t::GNU_all_source_call_sites, "DW_AT_GNU_all_source_call_sites"},
+    {attribute_t::GNU_macros, "DW_AT_GNU_macros"},
+    {attribute_t::GNU_deleted, "DW_AT_GNU_deleted"},
+    {attribute_t::GNU_dwo_name, "DW_AT_GNU_dwo_name"},
+    {attribute_t::GNU_dwo_id, "DW_AT_GNU_dwo_id"},
+    {attribute_t::GNU_ranges_base, "DW_AT_GNU_ranges_base"},
+    {attribute_t::GNU_addr_base, "DW_AT_GNU_addr_base"},
+    {attribute_t::GNU_pubnames, "DW_AT_GNU_pubnames"},
+    {attribute_t::GNU_pubtypes, "DW_AT_GNU_pubtypes"},
+    {attribute_t::GNU_discriminator, "DW_AT_GNU_discriminator"},
+    {attribute_t::GNU_locviews, "DW_AT_GNU_locviews"},
+    {attribute_t::GNU_entry_view, "DW_AT_GNU_entry_view"},
+    {attribute_t::SUN_template, "DW_AT_SUN_template"},
+    {attribute_t::VMS_rtnbeg_pd_address, "DW_AT_VMS_rtnbeg_pd_address"},
+    {attribute_t::SUN_alignment, "DW_AT_SUN_alignment"},
+    {attribute_t::SUN_vtable, "DW_AT_SUN_vtable"},
+    {attribute_t::SUN_count_guarantee, "DW_AT_SUN_count_guarantee"},
+    {attribute_t::SUN_command_line, "DW_AT_SUN_command_line"},
+    {attribute_t::SUN_vbase, "DW_AT_SUN_vbase"},
+    {attribute_t::SUN_compile_options, "DW_AT_SUN_compile_options"},
+    {attribute_t::SUN_language, "DW_AT_SUN_language"},
+    {attribute_t::SUN_browser_file, "DW_AT_SUN_browser_file"},
+    {attribute_t::SUN_vtable_abi, "DW_AT_SUN_vtable_abi"},
+    {attribute_t::SUN_func_offsets, "DW_AT_SUN_func_offsets"},
+    {attribute_t::SUN_cf_kind, "DW_AT_SUN_cf_kind"},
+    {attribute_t::SUN_vtable_index, "DW_AT_SUN_vtable_index"},
+    {attribute_t::SUN_omp_tpriv_addr, "DW_AT_SUN_omp_tpriv_addr"},
+    {attribute_t::SUN_omp_child_func, "DW_AT_SUN_omp_child_func"},
+    {attribute_t::SUN_func_offset, "DW_AT_SUN_func_offset"},
+    {attribute_t::SUN_memop_type_ref, "DW_AT_SUN_memop_type_ref"},
+    {attribute_t::SUN_profile_id, "DW_AT_SUN_profile_id"},
+    {attribute_t::SUN_memop_signature, "DW_AT_SUN_memop_signature"},
+    {attribute_t::SUN_obj_dir, "DW_AT_SUN_obj_dir"},
+    {attribute_t::SUN_obj_file, "DW_AT_SUN_obj_file"},
+    {attribute_t::SUN_original_name, "DW_AT_SUN_original_name"},
+    {attribute_t::SUN_hwcprof_signature, "DW_AT_SUN_hwcprof_signature"},
+    {attribute_t::SUN_amd64_parmdump, "DW_AT_SUN_amd64_parmdump"},
+    {attribute_t::SUN_part_link_name, "DW_AT_SUN_part_link_name"},
+    {attribute_t::SUN_link_name, "DW_AT_SUN_link_name"},
+    {attribute_t::SUN_pass_with_const, "DW_AT_SUN_pass_with_const"},
+    {attribute_t::SUN_return_with_const, "DW_AT_SUN_return_with_const"},
+    {attribute_t::SUN_import_by_name, "DW_AT_SUN_import_by_name"},
+    {attribute_t::SUN_f90_pointer, "DW_AT_SUN_f90_pointer"},
+    {attribute_t::SUN_pass_by_ref, "DW_AT_SUN_pass_by_ref"},
+    {attribute_t::SUN_f90_allocatable, "DW_AT_SUN_f90_allocatable"},
+    {attribute_t::SUN_f90_assumed_shape_array, "DW_AT_SUN_f90_assumed_shape_array"},
+    {attribute_t::SUN_c_vla, "DW_AT_SUN_c_vla"},
+    {attribute_t::SUN_return_value_ptr, "DW_AT_SUN_return_value_ptr"},
+    {attribute_t::SUN_dtor_start, "DW_AT_SUN_dtor_start"},
+    {attribute_t::SUN_dtor_length, "DW_AT_SUN_dtor_length"},
+    {attribute_t::SUN_dtor_state_initial, "DW_AT_SUN_dtor_state_initial"},
+    {attribute_t::SUN_dtor_state_final, "DW_AT_SUN_dtor_state_final"},
+    {attribute_t::SUN_dtor_state_deltas, "DW_AT_SUN_dtor_state_deltas"},
+    {attribute_t::SUN_import_by_lname, "DW_AT_SUN_import_by_lname"},
+    {attribute_t::SUN_f90_use_only, "DW_AT_SUN_f90_use_only"},
+    {attribute_t::SUN_namelist_spec, "DW_AT_SUN_namelist_spec"},
+    {attribute_t::SUN_is_omp_child_func, "DW_AT_SUN_is_omp_child_func"},
+    {attribute_t::SUN_fortran_main_alias, "DW_AT_SUN_fortran_main_alias"},
+    {attribute_t::SUN_fortran_based, "DW_AT_SUN_fortran_based"},
+    {attribute_t::ALTIUM_loclist, "DW_AT_ALTIUM_loclist"},
+    {attribute_t::use_GNAT_descriptive_type, "DW_AT_use_GNAT_descriptive_type"},
+    {attribute_t::GNAT_descriptive_type, "DW_AT_GNAT_descriptive_type"},
+    {attribute_t::GNU_numerator, "DW_AT_GNU_numerator"},
+    {attribute_t::GNU_denominator, "DW_AT_GNU_denominator"},
+    {attribute_t::GNU_bias, "DW_AT_GNU_bias"},
+    {attribute_t::go_kind, "DW_AT_go_kind"},
+    {attribute_t::go_key, "DW_AT_go_key"},
+    {attribute_t::go_elem, "DW_AT_go_elem"},
+    {attribute_t::go_embedded_field, "DW_AT_go_embedded_field"},
+    {attribute_t::go_runtime_type, "DW_AT_go_runtime_type"},
+    {attribute_t::upc_threads_scaled, "DW_AT_upc_threads_scaled"},
+    {attribute_t::IBM_wsa_addr, "DW_AT_IBM_wsa_addr"},
+    {attribute_t::IBM_home_location, "DW_AT_IBM_home_location"},
+    {attribute_t::IBM_alt_srcview, "DW_AT_IBM_alt_srcview"},
+    {attribute_t::PGI_lbase, "DW_AT_PGI_lbase"},
+    {attribute_t::PGI_soffset, "DW_AT_PGI_soffset"},
+    {attribute_t::PGI_lstride, "DW_AT_PGI_lstride"},
+    {attribute_t::BORLAND_property_read, "DW_AT_BORLAND_property_read"},
+    {attribute_t::BORLAND_property_write, "DW_AT_BORLAND_property_write"},
+    {attribute_t::BORLAND_property_implements, "DW_AT_BORLAND_property_implements"},
+    {attribute_t::BORLAND_property_index, "DW_AT_BORLAND_property_index"},
+    {attribute_t::BORLAND_property_default, "DW_AT_BORLAND_property_default"},
+    {attribute_t::BORLAND_Delphi_unit, "DW_AT_BORLAND_Delphi_unit"},
+    {attribute_t::BORLAND_Delphi_class, "DW_AT_BORLAND_Delphi_class"},
+    {attribute_t::BORLAND_Delphi_record, "DW_AT_BORLAND_Delphi_record"},
+    {attribute_t::BORLAND_Delphi_metaclass, "DW_AT_BORLAND_Delphi_metaclass"},
+    {attribute_t::BORLAND_Delphi_constructor, "DW_AT_BORLAND_Delphi_constructor"},
+    {attribute_t::BORLAND_Delphi_destructor, "DW_AT_BORLAND_Delphi_destructor"},
+    {attribute_t::BORLAND_Delphi_anonymous_method, "DW_AT_BORLAND_Delphi_anonymous_method"},
+    {attribute_t::BORLAND_Delphi_interface, "DW_AT_BORLAND_Delphi_interface"},
+    {attribute_t::BORLAND_Delphi_ABI, "DW_AT_BORLAND_Delphi_ABI"},
+    {attribute_t::BORLAND_Delphi_frameptr, "DW_AT_BORLAND_Delphi_frameptr"},
+    {attribute_t::BORLAND_closure, "DW_AT_BORLAND_closure"},
+    {attribute_t::LLVM_include_path, "DW_AT_LLVM_include_path"},
+    {attribute_t::LLVM_config_macros, "DW_AT_LLVM_config_macros"},
+    {attribute_t::LLVM_sysroot, "DW_AT_LLVM_sysroot"},
+    {attribute_t::LLVM_tag_offset, "DW_AT_LLVM_tag_offset"},
+    {attribute_t::LLVM_apinotes, "DW_AT_LLVM_apinotes"},
+    {attribute_t::LLVM_active_lane, "DW_AT_LLVM_active_lane"},
+    {attribute_t::LLVM_augmentation, "DW_AT_LLVM_augmentation"},
+    {attribute_t::LLVM_lanes, "DW_AT_LLVM_lanes"},
+    {attribute_t::LLVM_lane_pc, "DW_AT_LLVM_lane_pc"},
+    {attribute_t::LLVM_vector_size, "DW_AT_LLVM_vector_size"},
+    {attribute_t::APPLE_optimized, "DW_AT_APPLE_optimized"},
+    {attribute_t::APPLE_flags, "DW_AT_APPLE_flags"},
+    {attribute_t::APPLE_isa, "DW_AT_APPLE_isa"},
+    {attribute_t::APPLE_block, "DW_AT_APPLE_block"},
+    {attribute_t::APPLE_major_runtime_vers, "DW_AT_APPLE_major_runtime_vers"},
+    {attribute_t::APPLE_runtime_class, "DW_AT_APPLE_runtime_class"},
+    {attribute_t::APPLE_omit_frame_ptr, "DW_AT_APPLE_omit_frame_ptr"},
+    {attribute_t::APPLE_property_name, "DW_AT_APPLE_property_name"},
+    {attribute_t::APPLE_property_getter, "DW_AT_APPLE_property_getter"},
+    {attribute_t::APPLE_property_setter, "DW_AT_APPLE_property_setter"},
+    {attribute_t::APPLE_property_attribute, "DW_AT_APPLE_property_attribute"},
+    {attribute_t::APPLE_objc_complete_type, "DW_AT_APPLE_objc_complete_type"},
+    {attribute_t::APPLE_property, "DW_AT_APPLE_property"},
+    {attribute_t::APPLE_objc_direct, "DW_AT_APPLE_objc_direct"},
+    {attribute_t::APPLE_sdk, "DW_AT_APPLE_sdk"},
+    {attribute_t::APPLE_origin, "DW_AT_APPLE_origin"},
+    {attribute_t::hi_user, "DW_AT_hi_user"},
+});
+} // namespace details
+
+constexpr std::string_view to_string(attribute_t at)
+{
+    const auto *entry = details::find_entry(details::attribute_t_names, at);
+    return entry ? entry->name : std::string_view();
+}
+
 inline std::ostream &operator<<(std::ostream &os, attribute_t at)
 {
-    const char *name = nullptr;
-    int res = dwarf_get_AT_name(static_cast<Dwarf_Half>(at), &name);
-    if (res != DW_DLV_OK) {
+    const auto name = to_string(at);
+    if (name.empty()) {
         os << "<bogus attrnum>";
     }
     else {
@@ -0,0 +1,282 @@
+#pragma once
+
+#include <libdwarf.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <cppdwarf/details/exceptions.hpp>
+
+namespace cppdwarf {
+
+// Tally of the errors libdwarf reported for one debug session, by libdwarf error number (DW_DLE_*). The counters are
+// allocated up front, so counting an error never allocates, and can be bumped from several threads.
+class error_counts {
+public:
+    struct entry {
+        Dwarf_Unsigned number;
+        std::string name;
+        std::size_t count;
+    };
+
+    void add(Dwarf_Error error) noexcept
+    {
+        const auto number = std::min<Dwarf_Unsigned>(dwarf_errno(error), unknown);
+        counts_[number].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::size_t count(Dwarf_Unsigned number) const noexcept
+    {
+        return counts_[std::min<Dwarf_Unsigned>(number, unknown)].load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] std::size_t total() const noexcept
+    {
+        std::size_t total = 0;
+        for (const auto &count : counts_) {
+            total += count.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    // the error numbers seen so far, most frequent first
+    [[nodiscard]] std::vector<entry> summary() const
+    {
+        std::vector<entry> result;
+        for (Dwarf_Unsigned number = 0; number <= unknown; ++number) {
+            if (const auto n = count(number); n > 0) {
+                const char *name = number < unknown ? dwarf_errmsg_by_number(number) : nullptr;
+                result.push_back({number, name ? name : "unknown error", n});
+            }
+        }
+        std::stable_sort(result.begin(), result.end(), [](const auto &a, const auto &b) { return a.count > b.count; });
+        return result;
+    }
+
+private:
+    static constexpr Dwarf_Unsigned unknown = DW_DLE_LAST + 1; // error numbers libdwarf does not know about
+
+    std::array<std::atomic<std::size_t>, unknown + 1> counts_{};
+};
+
+namespace details {
+// The error_counts of the debug sessions that count errors, looked up only on error paths
+class error_registry {
+public:
+    static void add(Dwarf_Debug dbg, error_counts *counts)
+    {
+        auto &r = instance();
+        std::lock_guard lock(r.mutex_);
+        r.entries_.emplace_back(dbg, counts);
+        r.size_.store(r.entries_.size(), std::memory_order_release);
+    }
+
+    static void remove(Dwarf_Debug dbg)
+    {
+        auto &r = instance();
+        std::lock_guard lock(r.mutex_);
+        r.entries_.erase(std::remove_if(r.entries_.begin(), r.entries_.end(),
+                                        [dbg](const auto &entry) { return entry.first == dbg; }),
+                         r.entries_.end());
+        r.size_.store(r.entries_.size(), std::memory_order_release);
+    }
+
+    static error_counts *find(Dwarf_Debug dbg) noexcept
+    {
+        auto &r = instance();
+        if (r.size_.load(std::memory_order_acquire) == 0) {
+            return nullptr;
+        }
+        std::lock_guard lock(r.mutex_);
+        for (const auto &[key, counts] : r.entries_) {
+            if (key == dbg) {
+                return counts;
+            }
+        }
+        return nullptr;
+    }
+
+private:
+    static error_registry &instance()
+    {
+        static error_registry registry;
+        return registry;
+    }
+
+    std::mutex mutex_;
+    std::atomic<std::size_t> size_ = 0;
+    std::vector<std::pair<Dwarf_Debug, error_counts *>> entries_;
+};
+} // namespace details
+
+// Owns the Dwarf_Error a libdwarf call hands back on DW_DLV_ERROR and frees it, libdwarf allocates one for every
+// error and keeps it until it is passed to dwarf_dealloc_error().
+class dwarf_error {
+public:
+    explicit dwarf_error(Dwarf_Debug dbg) noexcept : dbg_(dbg) {}
+
+    ~dwarf_error()
+    {
+        reset();
+    }
+
+    dwarf_error(const dwarf_error &) = delete;
+    dwarf_error &operator=(const dwarf_error &) = delete;
+
+    // the out parameter to pass to libdwarf, frees the error of a previous call made with the same object
+    Dwarf_Error *out() noexcept
+    {
+        reset();
+        return &error_;
+    }
+
+    [[nodiscard]] std::string message() const
+    {
+        return error_ ? dwarf_errmsg(error_) : "";
+    }
+
+    void reset() noexcept
+    {
+        if (error_) {
+            if (auto *counts = details::error_registry::find(dbg_)) {
+                counts->add(error_);
+            }
+            dwarf_dealloc_error(dbg_, error_);
+            error_ = nullptr;
+        }
+    }
+
+private:
+    Dwarf_Debug dbg_;
+    Dwarf_Error error_ = nullptr;
+};
+
+// Why a try_* lookup did not produce a value
+enum class errc {
+    no_entry = 1,  // the DIE, attribute or value does not exist (DW_DLV_NO_ENTRY)
+    type_mismatch, // the attribute's form does not hold a value of the requested type
+    dwarf_error,   // libdwarf reported an error (DW_DLV_ERROR)
+};
+
+inline const char *to_string(errc e)
+{
+    switch (e) {
+    case errc::no_entry:
+        return "no entry";
+    case errc::type_mismatch:
+        return "type mismatch";
+    case errc::dwarf_error:
+        return "libdwarf error";
+    }
+    return "unknown error";
+}
+
+// maps the result of a libdwarf call that did not return DW_DLV_OK
+constexpr errc errc_of(int res) noexcept
+{
+    return res == DW_DLV_NO_ENTRY ? errc::no_entry : errc::dwarf_error;
+}
+
+// The value of a try_* lookup or the reason there is none. The try_* functions never throw for a missing value, a
+// type mismatch or a libdwarf error, which makes them suited to probing many DIEs for optional data:
+//     if (auto line = attr.try_get<std::int64_t>()) {
+//         use(*line);
+//     }
+template <typename T>
+class expected {
+public:
+    expected(T value) : value_(std::move(value)) {} // NOLINT(google-explicit-constructor)
+    expected(errc error) noexcept : error_(error) {} // NOLINT(google-explicit-constructor)
+
+    [[nodiscard]] bool has_value() const noexcept
+    {
+        return value_.has_value();
+    }
+
+    explicit operator bool() const noexcept
+    {
+        return has_value();
+    }
+
+    // only meaningful without a value
+    [[nodiscard]] errc error() const noexcept
+    {
+        return error_;
+    }
+
+    // throws other_error without a value
+    T &value() &
+    {
+        check();
+        return *value_;
+    }
+
+    const T &value() const &
+    {
+        check();
+        return *value_;
+    }
+
+    T &&value() &&
+    {
+        check();
+        return std::move(*value_);
+    }
+
+    template <typename U>
+    T value_or(U &&fallback) const &
+    {
+        return value_ ? *value_ : static_cast<T>(std::forward<U>(fallback));
+    }
+
+    template <typename U>
+    T value_or(U &&fallback) &&
+    {
+        return value_ ? std::move(*value_) : static_cast<T>(std::forward<U>(fallback));
+    }
+
+    T &operator*() &
+    {
+        return *value_;
+    }
+
+    const T &operator*() const &
+    {
+        return *value_;
+    }
+
+    T &&operator*() &&
+    {
+        return std::move(*value_);
+    }
+
+    T *operator->()
+    {
+        return &*value_;
+    }
+
+    const T *operator->() const
+    {
+        return &*value_;
+    }
+
+private:
+    void check() const
+    {
+        if (!value_) {
+            throw other_error(std::string("no value: ") + to_string(error_));
+        }
+    }
+
+    std::optional<T> value_;
+    errc error_ = errc::no_entry;
+};
+
+} // namespace cppdwarf
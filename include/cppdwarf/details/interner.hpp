@@ -0,0 +1,119 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace cppdwarf {
+
+// Stores every distinct string once, e.g. the file names, producers and type names that repeat across the compilation
+// units of one binary and across binaries, see debug_set::strings(). intern() returns a view of the stored copy, which
+// stays valid as long as the interner lives; two equal strings get views of the same bytes, so the views may also be
+// compared by data().
+//
+// Thread-safe. The strings are spread over shards by hash, each with its own lock, so concurrent interning mostly does
+// not contend. Strings are copied into large chunks instead of being allocated one by one.
+class string_interner {
+public:
+    struct stats {
+        std::size_t strings = 0;  // distinct strings stored
+        std::size_t bytes = 0;    // their sizes added up
+        std::size_t lookups = 0;  // calls to intern()
+        std::size_t reserved = 0; // memory held by the chunks
+    };
+
+    string_interner() = default;
+    string_interner(const string_interner &) = delete;
+    string_interner &operator=(const string_interner &) = delete;
+
+    std::string_view intern(std::string_view str)
+    {
+        const auto hash = std::hash<std::string_view>{}(str);
+        auto &s = shards_[hash % shard_count];
+        const std::lock_guard lock(s.mutex);
+        ++s.lookups;
+        if (auto it = s.strings.find(str); it != s.strings.end()) {
+            return *it;
+        }
+        const std::string_view stored(s.store(str), str.size());
+        s.strings.insert(stored);
+        s.bytes += str.size();
+        return stored;
+    }
+
+    // A path is interned in its lexically normal form with '/' separators, so "src/./a.cpp" and "src/b/../a.cpp"
+    // are stored once. Symbolic links are not resolved.
+    std::string_view intern_path(std::string_view path)
+    {
+        if (path.empty()) {
+            return intern(path);
+        }
+        return intern(std::filesystem::path(path).lexically_normal().generic_string());
+    }
+
+    [[nodiscard]] stats get_stats() const
+    {
+        stats result;
+        for (const auto &s : shards_) {
+            const std::lock_guard lock(s.mutex);
+            result.strings += s.strings.size();
+            result.bytes += s.bytes;
+            result.lookups += s.lookups;
+            result.reserved += s.reserved;
+        }
+        return result;
+    }
+
+private:
+    static constexpr std::size_t shard_count = 16;
+    static constexpr std::size_t chunk_size = 64 * 1024;
+
+    struct shard {
+        // copies `str` and a NUL, so the stored strings can be handed to C APIs as well
+        const char *store(std::string_view str)
+        {
+            const auto size = str.size() + 1;
+            if (size > chunk_size / 4) {
+                // a string this long gets a chunk of its own rather than wasting the rest of the current one
+                reserved += size;
+                return copy(large.emplace_back(std::make_unique<char[]>(size)).get(), str);
+            }
+            if (chunks.empty() || chunk_size - used < size) {
+                chunks.push_back(std::make_unique<char[]>(chunk_size));
+                reserved += chunk_size;
+                used = 0;
+            }
+            auto *dest = chunks.back().get() + used;
+            used += size;
+            return copy(dest, str);
+        }
+
+        static const char *copy(char *dest, std::string_view str)
+        {
+            std::memcpy(dest, str.data(), str.size());
+            dest[str.size()] = '\0';
+            return dest;
+        }
+
+        mutable std::mutex mutex;
+        std::unordered_set<std::string_view> strings;
+        std::vector<std::unique_ptr<char[]>> chunks; // the one filled next is last
+        std::vector<std::unique_ptr<char[]>> large;
+        std::size_t used = 0; // bytes used in the last chunk
+        std::size_t bytes = 0;
+        std::size_t lookups = 0;
+        std::size_t reserved = 0;
+    };
+
+    std::array<shard, shard_count> shards_;
+};
+
+} // namespace cppdwarf
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#include <immintrin.h>
+#define CPPDWARF_LEB128_BMI2
+#endif
+
+// LEB128 decoding for the native reader. Values are decoded a 64-bit word at a time: the terminating byte is found
+// from the continuation bits of the whole word, and the 7-bit groups are packed together without a loop, either with
+// a few shifts and masks or, on CPUs where it is fast, with a single BMI2 pext. The byte-at-a-time decoder serves
+// values longer than 8 bytes, the last bytes of a buffer and big-endian hosts.
+namespace cppdwarf::leb128 {
+
+template <typename T>
+struct result {
+    T value;
+    std::size_t length; // bytes consumed, 0 if the buffer ended inside the value
+};
+
+inline result<std::uint64_t> decode_unsigned_scalar(const std::uint8_t *pos, const std::uint8_t *end)
+{
+    std::uint64_t value = 0;
+    unsigned shift = 0;
+    for (const auto *p = pos; p < end; ++p) {
+        if (shift < 64) {
+            value |= static_cast<std::uint64_t>(*p & 0x7f) << shift;
+        }
+        shift += 7;
+        if (!(*p & 0x80)) {
+            return {value, static_cast<std::size_t>(p - pos) + 1};
+        }
+    }
+    return {0, 0};
+}
+
+inline result<std::int64_t> decode_signed_scalar(const std::uint8_t *pos, const std::uint8_t *end)
+{
+    auto [value, length] = decode_unsigned_scalar(pos, end);
+    const auto shift = 7 * length;
+    if (length > 0 && shift < 64 && (pos[length - 1] & 0x40)) {
+        value |= ~std::uint64_t{0} << shift; // sign extend
+    }
+    return {static_cast<std::int64_t>(value), length};
+}
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__ || defined(_WIN32)
+#define CPPDWARF_LEB128_WORDWISE
+
+inline unsigned count_trailing_zeros(std::uint64_t x)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index = 0;
+    _BitScanForward64(&index, x);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctzll(x));
+#endif
+}
+
+// packs the 7-bit groups held in the low 7 bits of each byte into one value
+inline std::uint64_t pack_groups(std::uint64_t x)
+{
+    x = ((x & 0x7f007f007f007f00ULL) >> 1) | (x & 0x007f007f007f007fULL);
+    x = ((x & 0x3fff00003fff0000ULL) >> 2) | (x & 0x00003fff00003fffULL);
+    x = ((x & 0x0fffffff00000000ULL) >> 4) | (x & 0x000000000fffffffULL);
+    return x;
+}
+
+#ifdef CPPDWARF_LEB128_BMI2
+__attribute__((target("bmi2"))) inline std::uint64_t pack_groups_bmi2(std::uint64_t x)
+{
+    return _pext_u64(x, 0x7f7f7f7f7f7f7f7fULL);
+}
+
+inline bool use_bmi2()
+{
+    // pext is microcoded and far slower than the shifts on AMD CPUs before Zen 3
+    static const bool fast_pext =
+        __builtin_cpu_supports("bmi2") && !__builtin_cpu_is("znver1") && !__builtin_cpu_is("znver2");
+    return fast_pext;
+}
+#endif
+#endif
+
+inline result<std::uint64_t> decode_unsigned(const std::uint8_t *pos, const std::uint8_t *end)
+{
+#ifdef CPPDWARF_LEB128_WORDWISE
+    if (end - pos >= 8) {
+        std::uint64_t word = 0;
+        std::memcpy(&word, pos, sizeof(word));
+        const auto stops = ~word & 0x8080808080808080ULL;
+        if (stops != 0) {
+            const std::size_t length = (count_trailing_zeros(stops) >> 3) + 1;
+            const auto bytes = length == 8 ? ~std::uint64_t{0} : (std::uint64_t{1} << (length * 8)) - 1;
+            const auto groups = word & bytes & 0x7f7f7f7f7f7f7f7fULL;
+#ifdef CPPDWARF_LEB128_BMI2
+            if (use_bmi2()) {
+                return {pack_groups_bmi2(groups), length};
+            }
+#endif
+            return {pack_groups(groups), length};
+        }
+    }
+#endif
+    return decode_unsigned_scalar(pos, end);
+}
+
+inline result<std::int64_t> decode_signed(const std::uint8_t *pos, const std::uint8_t *end)
+{
+    auto [value, length] = decode_unsigned(pos, end);
+    const auto shift = 7 * length;
+    if (length > 0 && shift < 64 && (pos[length - 1] & 0x40)) {
+        value |= ~std::uint64_t{0} << shift; // sign extend
+    }
+    return {static_cast<std::int64_t>(value), length};
+}
+
+// number of bytes of the value at `pos` without decoding it, 0 if the buffer ends inside it
+inline std::size_t length(const std::uint8_t *pos, const std::uint8_t *end)
+{
+#ifdef CPPDWARF_LEB128_WORDWISE
+    if (end - pos >= 8) {
+        std::uint64_t word = 0;
+        std::memcpy(&word, pos, sizeof(word));
+        const auto stops = ~word & 0x8080808080808080ULL;
+        if (stops != 0) {
+            return (count_trailing_zeros(stops) >> 3) + 1;
+        }
+    }
+#endif
+    for (const auto *p = pos; p < end; ++p) {
+        if (!(*p & 0x80)) {
+            return static_cast<std::size_t>(p - pos) + 1;
+        }
+    }
+    return 0;
+}
+
+} // namespace cppdwarf::leb128
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory_resource>
+
+// Accounting of the memory cppdwarf holds. The heap allocations of the wrappers are counted by a counting memory
+// resource compiled in only when CPPDWARF_STATS is defined, like the performance counters in stats.hpp; the memory of
+// a debug object, see debug::memory(), is computed from its parts and always available.
+namespace cppdwarf {
+
+class attribute;
+class attribute_list;
+class die;
+
+// What the wrappers allocate on the heap for, see heap_usage
+enum class memory_category {
+    dies,            // dies held by child iterators
+    attribute_lists, // attribute lists and their containers
+    attributes,
+    other,
+};
+
+inline constexpr std::size_t memory_category_count = static_cast<std::size_t>(memory_category::other) + 1;
+
+constexpr const char *to_string(memory_category category)
+{
+    constexpr const char *names[] = {"dies", "attribute lists", "attributes", "other"};
+    return names[static_cast<std::size_t>(category)];
+}
+
+// the category make_arena_ptr<T> counts an object under
+template <typename T>
+struct memory_category_of {
+    static constexpr memory_category value = memory_category::other;
+};
+
+template <>
+struct memory_category_of<die> {
+    static constexpr memory_category value = memory_category::dies;
+};
+
+template <>
+struct memory_category_of<attribute_list> {
+    static constexpr memory_category value = memory_category::attribute_lists;
+};
+
+template <>
+struct memory_category_of<attribute> {
+    static constexpr memory_category value = memory_category::attributes;
+};
+
+// A snapshot of the heap memory the wrappers hold, see debug::heap(). Objects allocated from an arena are not
+// included: the arena's memory belongs to its owner, see arena::allocated().
+struct heap_usage {
+    bool enabled = false; // false if cppdwarf was built without CPPDWARF_STATS, all counts are zero then
+    std::array<std::size_t, memory_category_count> bytes{};       // held now
+    std::array<std::size_t, memory_category_count> peak_bytes{};  // the most held at any time since the last reset
+    std::array<std::size_t, memory_category_count> allocations{}; // not deallocated yet
+
+    [[nodiscard]] std::size_t bytes_of(memory_category category) const
+    {
+        return bytes[static_cast<std::size_t>(category)];
+    }
+
+    [[nodiscard]] std::size_t total() const
+    {
+        std::size_t sum = 0;
+        for (const auto b : bytes) {
+            sum += b;
+        }
+        return sum;
+    }
+};
+
+// The memory a debug object holds, by subsystem, see debug::memory()
+struct memory_usage {
+    // the section buffers of the ELF loader, decompressed, see debug::options::preload_sections
+    std::size_t preloaded_sections = 0;
+    // An estimate of the debug sections libdwarf reads itself, not a figure libdwarf reports: the sizes in the file
+    // of the .debug_* and .zdebug_* sections, the compressed ones counted compressed although libdwarf holds them
+    // decompressed, and sections nothing reads, which libdwarf never loads, counted as well. Zero when the sections
+    // are preloaded, libdwarf then reads them from the loader's buffers.
+    std::size_t libdwarf_sections = 0;
+    std::size_t unit_table = 0; // see debug::units()
+
+    [[nodiscard]] std::size_t total() const
+    {
+        return preloaded_sections + libdwarf_sections + unit_table;
+    }
+};
+
+namespace details {
+
+#ifdef CPPDWARF_STATS
+// Counts what passes through to the default memory resource. Process-wide, one per category; relaxed atomics are
+// enough for accounting, the peak may miss a race between two threads.
+class counting_resource : public std::pmr::memory_resource {
+public:
+    static counting_resource &of(memory_category category)
+    {
+        static std::array<counting_resource, memory_category_count> resources;
+        return resources[static_cast<std::size_t>(category)];
+    }
+
+    void snapshot(memory_category category, heap_usage &usage) const
+    {
+        const auto i = static_cast<std::size_t>(category);
+        usage.bytes[i] = bytes_.load(std::memory_order_relaxed);
+        usage.peak_bytes[i] = peak_.load(std::memory_order_relaxed);
+        usage.allocations[i] = allocations_.load(std::memory_order_relaxed);
+    }
+
+    void reset_peak()
+    {
+        peak_.store(bytes_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+
+private:
+    void *do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        void *p = upstream_->allocate(bytes, alignment);
+        const auto held = bytes_.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+        allocations_.fetch_add(1, std::memory_order_relaxed);
+        auto peak = peak_.load(std::memory_order_relaxed);
+        while (held > peak && !peak_.compare_exchange_weak(peak, held, std::memory_order_relaxed)) {
+        }
+        return p;
+    }
+
+    void do_deallocate(void *p, std::size_t bytes, std::size_t alignment) override
+    {
+        upstream_->deallocate(p, bytes, alignment);
+        bytes_.fetch_sub(bytes, std::memory_order_relaxed);
+        allocations_.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+    {
+        return this == &other;
+    }
+
+    std::pmr::memory_resource *upstream_ = std::pmr::get_default_resource();
+    std::atomic<std::size_t> bytes_{0};
+    std::atomic<std::size_t> peak_{0};
+    std::atomic<std::size_t> allocations_{0};
+};
+#endif
+
+// the resource the wrappers allocate objects of a category from when no arena is in scope
+inline std::pmr::memory_resource *heap_resource([[maybe_unused]] memory_category category)
+{
+#ifdef CPPDWARF_STATS
+    return &counting_resource::of(category);
+#else
+    return std::pmr::get_default_resource();
+#endif
+}
+
+inline heap_usage heap_snapshot()
+{
+    heap_usage usage;
+#ifdef CPPDWARF_STATS
+    usage.enabled = true;
+    for (std::size_t i = 0; i < memory_category_count; ++i) {
+        counting_resource::of(static_cast<memory_category>(i)).snapshot(static_cast<memory_category>(i), usage);
+    }
+#endif
+    return usage;
+}
+
+inline void heap_reset_peak()
+{
+#ifdef CPPDWARF_STATS
+    for (std::size_t i = 0; i < memory_category_count; ++i) {
+        counting_resource::of(static_cast<memory_category>(i)).reset_peak();
+    }
+#endif
+}
+
+} // namespace details
+} // namespace cppdwarf
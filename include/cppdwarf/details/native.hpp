@@ -0,0 +1,1370 @@
+#pragma once
+
+#include <libdwarf.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <cppdwarf/details/attribute.hpp>
+#include <cppdwarf/details/debug.hpp>
+#include <cppdwarf/details/die.hpp>
+#include <cppdwarf/details/enums.hpp>
+#include <cppdwarf/details/error.hpp>
+#include <cppdwarf/details/exceptions.hpp>
+#include <cppdwarf/details/leb128.hpp>
+#include <cppdwarf/details/object.hpp>
+#include <cppdwarf/details/walk.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define CPPDWARF_NATIVE_MMAP
+#endif
+
+// A DIE reader that decodes .debug_info straight from the section bytes instead of calling into libdwarf for every
+// DIE and attribute. libdwarf is only used to locate the sections, to parse the abbreviation tables and for the
+// things off the hot path, such as the line table behind unit::src_files().
+//
+// The reader supports DWARF 2 to 5 in linked, little-endian objects whose sections are not compressed, unless the
+// debug preloaded and decompressed them (debug::options::preload_sections): relocations in relocatable object files
+// are not applied. Big-endian objects are rejected with init_error. The sections are memory-mapped from the file
+// where mmap is available, and read into buffers elsewhere. Type units in the DWARF 4 .debug_types section are not
+// covered, those are still read through debug::type_units().
+namespace cppdwarf::native {
+
+// Bounds-checked reader over a range of section bytes
+class cursor {
+public:
+    cursor(const std::uint8_t *pos, const std::uint8_t *end) : pos_(pos), end_(end) {}
+
+    [[nodiscard]] const std::uint8_t *position() const
+    {
+        return pos_;
+    }
+
+    // a little-endian value of 1 to 8 bytes
+    std::uint64_t fixed(std::size_t size)
+    {
+        require(size);
+        std::uint64_t value = 0;
+        std::memcpy(&value, pos_, size);
+        pos_ += size;
+        return value;
+    }
+
+    std::uint64_t uleb128()
+    {
+        const auto [value, length] = leb128::decode_unsigned(pos_, end_);
+        consume(length);
+        return value;
+    }
+
+    std::int64_t sleb128()
+    {
+        const auto [value, length] = leb128::decode_signed(pos_, end_);
+        consume(length);
+        return value;
+    }
+
+    // steps over a LEB128 value of either signedness without decoding it
+    void skip_leb128()
+    {
+        consume(leb128::length(pos_, end_));
+    }
+
+    std::string_view cstring()
+    {
+        const auto *nul = std::find(pos_, end_, std::uint8_t{0});
+        if (nul == end_) {
+            throw other_error("unterminated string in .debug_info");
+        }
+        std::string_view str(reinterpret_cast<const char *>(pos_), nul - pos_);
+        pos_ = nul + 1;
+        return str;
+    }
+
+    void skip(std::uint64_t size)
+    {
+        require(size);
+        pos_ += size;
+    }
+
+private:
+    void require(std::uint64_t size) const
+    {
+        if (size > static_cast<std::uint64_t>(end_ - pos_)) {
+            throw other_error("unexpected end of section data");
+        }
+    }
+
+    void consume(std::size_t length)
+    {
+        if (length == 0) {
+            throw other_error("unexpected end of section data");
+        }
+        pos_ += length;
+    }
+
+    const std::uint8_t *pos_;
+    const std::uint8_t *end_;
+};
+
+// A whole file mapped read-only into memory, or read into a buffer where mmap is not available
+class mapped_file {
+public:
+    explicit mapped_file(const std::string &path)
+    {
+#ifdef CPPDWARF_NATIVE_MMAP
+        const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) {
+            throw init_error("failed to open " + path);
+        }
+        struct stat st {};
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            throw init_error("failed to stat " + path);
+        }
+        size_ = static_cast<std::size_t>(st.st_size);
+        if (size_ > 0) {
+            void *addr = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (addr == MAP_FAILED) {
+                ::close(fd);
+                throw init_error("failed to map " + path);
+            }
+            data_ = static_cast<const std::uint8_t *>(addr);
+        }
+        ::close(fd); // the mapping stays valid
+#else
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file) {
+            throw init_error("failed to open " + path);
+        }
+        bytes_.resize(static_cast<std::size_t>(file.tellg()));
+        file.seekg(0);
+        file.read(reinterpret_cast<char *>(bytes_.data()), static_cast<std::streamsize>(bytes_.size()));
+        if (!file) {
+            throw init_error("failed to read " + path);
+        }
+        data_ = bytes_.data();
+        size_ = bytes_.size();
+#endif
+    }
+
+    mapped_file(const mapped_file &) = delete;
+    mapped_file &operator=(const mapped_file &) = delete;
+
+    ~mapped_file()
+    {
+#ifdef CPPDWARF_NATIVE_MMAP
+        if (data_) {
+            ::munmap(const_cast<std::uint8_t *>(data_), size_);
+        }
+#endif
+    }
+
+    [[nodiscard]] const std::uint8_t *data() const
+    {
+        return data_;
+    }
+
+    [[nodiscard]] std::size_t size() const
+    {
+        return size_;
+    }
+
+private:
+#ifndef CPPDWARF_NATIVE_MMAP
+    std::vector<std::uint8_t> bytes_;
+#endif
+    const std::uint8_t *data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+// The bytes of one debug section, mapped from the object file or borrowed from the elf_object that preloaded them
+class section {
+public:
+    section() = default;
+
+    // refers to bytes owned by someone else, who has to keep them alive and unchanged
+    section(const std::uint8_t *data, std::size_t size) : data_(data), size_(size) {}
+
+    [[nodiscard]] const std::uint8_t *data() const
+    {
+        return data_;
+    }
+
+    [[nodiscard]] std::size_t size() const
+    {
+        return size_;
+    }
+
+    [[nodiscard]] const std::uint8_t *end() const
+    {
+        return data_ + size_;
+    }
+
+    [[nodiscard]] std::string_view string_at(std::uint64_t offset) const
+    {
+        if (offset >= size_) {
+            throw other_error("string offset out of range");
+        }
+        cursor c(data_ + offset, end());
+        return c.cstring();
+    }
+
+private:
+    const std::uint8_t *data_ = nullptr;
+    std::size_t size_ = 0;
+};
+
+struct attribute_spec {
+    attribute_t type;
+    cppdwarf::form form;
+    std::int64_t implicit_const;
+};
+
+struct abbreviation {
+    std::uint64_t code = 0; // 0 for the unused slots of an abbreviation_table
+    cppdwarf::tag tag{};
+    bool has_children = false;
+    int sibling_index = -1; // position of DW_AT_sibling in the attributes, if present
+    std::vector<attribute_spec> attributes;
+};
+
+// One abbreviation table of .debug_abbrev, as parsed by libdwarf
+class abbreviation_table {
+public:
+    abbreviation_table(Dwarf_Debug dbg, std::uint64_t offset);
+
+    [[nodiscard]] const abbreviation &at(std::uint64_t code) const
+    {
+        if (code != 0 && code <= abbreviations_.size() && abbreviations_[code - 1].code == code) {
+            return abbreviations_[code - 1];
+        }
+        if (auto it = sparse_.find(code); it != sparse_.end()) {
+            return it->second;
+        }
+        throw other_error("invalid abbreviation code " + std::to_string(code));
+    }
+
+private:
+    // Producers number their abbreviations 1, 2, 3, ... so the codes index a vector. The codes come from the file,
+    // though: one far beyond the number of entries read so far goes to sparse_, so the vector stays within twice the
+    // size of the table whatever the codes are.
+    static constexpr std::uint64_t dense_slack = 64;
+
+    std::vector<abbreviation> abbreviations_;
+    std::unordered_map<std::uint64_t, abbreviation> sparse_;
+};
+
+class reader;
+class die;
+
+class unit {
+public:
+    // offset of the unit header in .debug_info
+    [[nodiscard]] std::size_t offset() const
+    {
+        return offset_;
+    }
+
+    // of the whole unit, header included
+    [[nodiscard]] std::size_t length() const
+    {
+        return static_cast<std::size_t>(end_ - begin_);
+    }
+
+    [[nodiscard]] int version() const
+    {
+        return version_;
+    }
+
+    // one of DW_UT_*, DW_UT_compile for units before DWARF 5
+    [[nodiscard]] int unit_type() const
+    {
+        return unit_type_;
+    }
+
+    [[nodiscard]] int address_size() const
+    {
+        return address_size_;
+    }
+
+    // 4 for 32-bit DWARF, 8 for 64-bit DWARF
+    [[nodiscard]] int offset_size() const
+    {
+        return offset_size_;
+    }
+
+    [[nodiscard]] native::die die() const;
+
+    // the line table's file names, read through libdwarf
+    [[nodiscard]] std::vector<std::string> src_files() const;
+
+    // same, through another handle on the same file, e.g. one per thread while several threads share the reader
+    [[nodiscard]] std::vector<std::string> src_files(const debug &dbg) const;
+
+private:
+    friend class reader;
+    friend class native::die;
+    friend class attribute;
+    friend class attribute_list;
+
+    const reader *reader_ = nullptr;
+    std::size_t offset_ = 0;
+    const std::uint8_t *begin_ = nullptr; // unit header
+    const std::uint8_t *end_ = nullptr;
+    const std::uint8_t *first_die_ = nullptr;
+    int version_ = 0;
+    int unit_type_ = 0;
+    int address_size_ = 0;
+    int offset_size_ = 0;
+    std::shared_ptr<const abbreviation_table> abbreviations_;
+    std::uint64_t str_offsets_base_ = 0;
+};
+
+// An attribute value decoded in place, mirrors cppdwarf::attribute
+class attribute {
+public:
+    attribute(const unit *u, const attribute_spec &spec, cppdwarf::form form, const std::uint8_t *value)
+        : unit_(u), spec_(&spec), form_(form), value_(value)
+    {
+    }
+
+    [[nodiscard]] attribute_t type() const
+    {
+        return spec_->type;
+    }
+
+    [[nodiscard]] cppdwarf::form form() const
+    {
+        return form_;
+    }
+
+    // strings in a supplementary object file are not resolved
+    [[nodiscard]] bool is_string() const noexcept
+    {
+        return class_of(form_) == form_class::string && form_ != form::strp_sup && form_ != form::GNU_strp_alt;
+    }
+
+    [[nodiscard]] bool is_integer() const noexcept
+    {
+        return class_of(form_) == form_class::constant && form_ != form::data16;
+    }
+
+    [[nodiscard]] bool is_boolean() const noexcept
+    {
+        return class_of(form_) == form_class::flag;
+    }
+
+    // references into a supplementary object file and type signatures are not resolved
+    [[nodiscard]] bool is_reference() const noexcept
+    {
+        return class_of(form_) == form_class::reference && form_ != form::ref_sig8 && form_ != form::ref_sup4 &&
+               form_ != form::ref_sup8 && form_ != form::GNU_ref_alt;
+    }
+
+    // .debug_info offset of the DIE a reference attribute points to
+    [[nodiscard]] std::size_t reference() const;
+
+    [[nodiscard]] bool is_block() const noexcept
+    {
+        return class_of(form_) == form_class::block || class_of(form_) == form_class::exprloc;
+    }
+
+    // the bytes of a block or expression value, in .debug_info
+    [[nodiscard]] std::pair<const std::uint8_t *, std::size_t> block() const;
+
+    template <typename T>
+    T get() const
+    {
+        static_assert(sizeof(T) == 0, "unsupported type for native::attribute::get()");
+        throw type_error("unsupported type for native::attribute::get()");
+    }
+
+    // the value as die::read() returns it, empty if the form does not hold that kind of value
+    template <attribute_kind Kind>
+    [[nodiscard]] std::optional<typename attribute_kind_traits<Kind>::value_type> as() const
+    {
+        if constexpr (Kind == attribute_kind::string) {
+            return is_string() ? std::optional<std::string>(get_string()) : std::nullopt;
+        }
+        else if constexpr (Kind == attribute_kind::flag) {
+            return is_boolean() ? std::optional<bool>(get_flag()) : std::nullopt;
+        }
+        else if constexpr (Kind == attribute_kind::reference) {
+            return is_reference() ? std::optional<std::size_t>(reference()) : std::nullopt;
+        }
+        else {
+            using value_type = typename attribute_kind_traits<Kind>::value_type;
+            return is_integer() ? std::optional<value_type>(static_cast<value_type>(get_integer())) : std::nullopt;
+        }
+    }
+
+private:
+    friend class native::die;
+    friend class attribute_list;
+    friend class reader;
+
+    [[nodiscard]] std::string_view get_string() const;
+
+    [[nodiscard]] bool get_flag() const
+    {
+        if (form_ == form::flag_present) {
+            return true;
+        }
+        if (form_ != form::flag) {
+            throw type_error("not a flag");
+        }
+        return *value_ != 0;
+    }
+
+    [[nodiscard]] std::int64_t get_integer() const;
+
+    // the value bytes of this attribute
+    [[nodiscard]] cursor value() const;
+
+    const unit *unit_;
+    const attribute_spec *spec_;
+    cppdwarf::form form_; // differs from spec_->form for DW_FORM_indirect
+    const std::uint8_t *value_;
+};
+
+// The attributes of a native::die, decoded while iterating
+class attribute_list {
+public:
+    class const_iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = attribute;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const attribute *;
+        using reference = const attribute &;
+
+        const_iterator(const unit *u, const abbreviation *abbrev, std::size_t index, const std::uint8_t *pos)
+            : unit_(u), abbrev_(abbrev), index_(index), pos_(pos)
+        {
+            load();
+        }
+
+        const_iterator &operator++()
+        {
+            auto c = current_->value();
+            skip_value(c, current_->form(), *unit_);
+            pos_ = c.position();
+            ++index_;
+            load();
+            return *this;
+        }
+
+        bool operator==(const const_iterator &other) const
+        {
+            return index_ == other.index_;
+        }
+
+        bool operator!=(const const_iterator &other) const
+        {
+            return !(*this == other);
+        }
+
+        reference operator*() const
+        {
+            if (!current_) {
+                throw invalid_iterator("end iterator");
+            }
+            return *current_;
+        }
+
+        pointer operator->() const
+        {
+            return &**this;
+        }
+
+        // position right after the last attribute, once the iterator has reached the end
+        [[nodiscard]] const std::uint8_t *position() const
+        {
+            return pos_;
+        }
+
+    private:
+        void load()
+        {
+            if (!abbrev_ || index_ >= abbrev_->attributes.size()) {
+                current_.reset();
+                return;
+            }
+            const auto &spec = abbrev_->attributes[index_];
+            auto form = spec.form;
+            const auto *value = pos_;
+            if (form == form::indirect) {
+                cursor c(pos_, unit_->end_);
+                form = static_cast<cppdwarf::form>(c.uleb128());
+                value = c.position();
+            }
+            current_.emplace(unit_, spec, form, value);
+        }
+
+        const unit *unit_;
+        const abbreviation *abbrev_;
+        std::size_t index_;
+        const std::uint8_t *pos_;
+        std::optional<attribute> current_;
+    };
+
+    attribute_list(const unit *u, const abbreviation *abbrev, const std::uint8_t *pos)
+        : unit_(u), abbrev_(abbrev), pos_(pos)
+    {
+    }
+
+    [[nodiscard]] const_iterator begin() const
+    {
+        return {unit_, abbrev_, 0, pos_};
+    }
+
+    [[nodiscard]] const_iterator end() const
+    {
+        return {unit_, nullptr, size(), pos_};
+    }
+
+    [[nodiscard]] std::optional<attribute> find(attribute_t type) const
+    {
+        for (const auto &attr : *this) {
+            if (attr.type() == type) {
+                return attr;
+            }
+        }
+        return std::nullopt;
+    }
+
+    // never empty, an optional so that `at(type)->get<T>()` reads as with cppdwarf::attribute_list::at()
+    [[nodiscard]] std::optional<attribute> at(attribute_t type) const
+    {
+        auto attr = find(type);
+        if (!attr) {
+            throw out_of_range("attribute not found");
+        }
+        return attr;
+    }
+
+    [[nodiscard]] bool contains(attribute_t type) const
+    {
+        return std::any_of(abbrev_->attributes.begin(), abbrev_->attributes.end(),
+                           [&](const attribute_spec &spec) { return spec.type == type; });
+    }
+
+    [[nodiscard]] std::size_t size() const
+    {
+        return abbrev_->attributes.size();
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return abbrev_->attributes.empty();
+    }
+
+    // advances `c` past a value of the given form
+    static void skip_value(cursor &c, cppdwarf::form form, const unit &u);
+
+private:
+    const unit *unit_;
+    const abbreviation *abbrev_;
+    const std::uint8_t *pos_;
+};
+
+// A DIE decoded in place. Unlike cppdwarf::die it is a small value that owns nothing, so copying it is free.
+class die {
+public:
+    class const_iterator;
+
+    die() = default;
+
+    // the DIE starting at `pos`, a null entry (code 0) gives a null die
+    die(const unit *u, const std::uint8_t *pos) : unit_(u), pos_(pos)
+    {
+        cursor c(pos, u->end_);
+        const auto code = c.uleb128();
+        attributes_ = c.position();
+        if (code != 0) {
+            abbrev_ = &u->abbreviations_->at(code);
+        }
+    }
+
+    [[nodiscard]] bool is_null() const
+    {
+        return abbrev_ == nullptr;
+    }
+
+    [[nodiscard]] std::size_t offset() const;
+
+    [[nodiscard]] std::size_t cu_offset() const
+    {
+        return pos_ - unit_->begin_;
+    }
+
+    [[nodiscard]] bool is_info() const
+    {
+        return true;
+    }
+
+    [[nodiscard]] cppdwarf::tag tag() const
+    {
+        return abbrev_->tag;
+    }
+
+    [[nodiscard]] bool has_children() const
+    {
+        return abbrev_->has_children;
+    }
+
+    [[nodiscard]] attribute_list attributes() const
+    {
+        return {unit_, abbrev_, attributes_};
+    }
+
+    // same as cppdwarf::die::read(), decodes only the requested attributes in one pass
+    template <attribute_t... Types>
+    [[nodiscard]] std::tuple<std::optional<attribute_value_t<Types>>...> read() const
+    {
+        std::tuple<std::optional<attribute_value_t<Types>>...> result;
+        for (const auto &attr : attributes()) {
+            read_into<Types...>(attr, result, std::make_index_sequence<sizeof...(Types)>{});
+        }
+        return result;
+    }
+
+    [[nodiscard]] const_iterator begin() const;
+    [[nodiscard]] const_iterator end() const;
+
+    // first child with one of the given tags, `tags` has to outlive the iterator
+    [[nodiscard]] const_iterator begin(const tag_set &tags) const;
+
+    class filtered_children;
+
+    // the children with one of the given tags, see cppdwarf::die::children()
+    [[nodiscard]] filtered_children children(const tag_set &tags) const;
+
+private:
+    template <attribute_t... Types, typename Tuple, std::size_t... Indices>
+    static void read_into(const attribute &attr, Tuple &result, std::index_sequence<Indices...>)
+    {
+        const auto type = attr.type();
+        ((type == Types ? static_cast<void>(std::get<Indices>(result) = attr.as<kind_of(Types)>())
+                        : static_cast<void>(0)),
+         ...);
+    }
+
+    // the position right after the attributes, where the first child starts
+    [[nodiscard]] const std::uint8_t *attributes_end() const
+    {
+        auto it = attributes().begin();
+        const auto last = attributes().end();
+        while (it != last) {
+            ++it;
+        }
+        return it.position();
+    }
+
+    // the position right after this DIE's subtree, where its next sibling starts
+    [[nodiscard]] const std::uint8_t *next_sibling() const;
+
+    const unit *unit_ = nullptr;
+    const std::uint8_t *pos_ = nullptr;
+    const std::uint8_t *attributes_ = nullptr;
+    const abbreviation *abbrev_ = nullptr;
+};
+
+class die::const_iterator {
+public:
+    using iterator_category = std::forward_iterator_tag;
+    using value_type = const die;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const die *;
+    using reference = const die &;
+
+    const_iterator() = default; // end iterator
+
+    const_iterator(const die &first, const tag_set *filter) : current_(first), filter_(filter)
+    {
+        settle();
+    }
+
+    const_iterator &operator++()
+    {
+        if (!current_.is_null()) {
+            current_ = die(current_.unit_, current_.next_sibling());
+            settle();
+        }
+        return *this;
+    }
+
+    bool operator==(const const_iterator &other) const
+    {
+        return current_.pos_ == other.current_.pos_;
+    }
+
+    bool operator!=(const const_iterator &other) const
+    {
+        return !(*this == other);
+    }
+
+    reference operator*() const
+    {
+        if (current_.is_null()) {
+            throw invalid_iterator("end iterator");
+        }
+        return current_;
+    }
+
+private:
+    // moves on to the first sibling that passes the filter, siblings that do not are stepped over without decoding
+    // their subtree
+    void settle()
+    {
+        while (!current_.is_null() && filter_ && !filter_->contains(current_.tag())) {
+            current_ = die(current_.unit_, current_.next_sibling());
+        }
+        if (current_.is_null()) {
+            current_ = die();
+        }
+    }
+
+    die current_;
+    const tag_set *filter_ = nullptr;
+};
+
+class die::filtered_children {
+public:
+    filtered_children(const die &parent, const tag_set &tags) : parent_(parent), tags_(tags) {}
+
+    [[nodiscard]] const_iterator begin() const
+    {
+        return parent_.begin(tags_);
+    }
+
+    [[nodiscard]] const_iterator end() const
+    {
+        return {};
+    }
+
+private:
+    die parent_;
+    tag_set tags_; // a copy, see cppdwarf::die::filtered_children
+};
+
+using walker = basic_walker<die>;
+
+// Iterates over the units in .debug_info of a debug file. Once constructed, a reader and the DIEs it hands out only
+// read memory, so several threads can share one as long as each does its libdwarf calls (unit::src_files) through
+// its own debug handle.
+class reader {
+public:
+    explicit reader(const debug &dbg);
+
+    // units point back into the reader's sections
+    reader(const reader &) = delete;
+    reader &operator=(const reader &) = delete;
+    reader(reader &&) = delete;
+    reader &operator=(reader &&) = delete;
+
+    [[nodiscard]] auto begin() const
+    {
+        return units_.cbegin();
+    }
+
+    [[nodiscard]] auto end() const
+    {
+        return units_.cend();
+    }
+
+    [[nodiscard]] std::size_t size() const
+    {
+        return units_.size();
+    }
+
+    // the unit containing a .debug_info offset
+    [[nodiscard]] const unit &unit_at(std::size_t offset) const
+    {
+        auto it = std::upper_bound(units_.begin(), units_.end(), offset,
+                                   [](std::size_t value, const unit &u) { return value < u.offset(); });
+        if (it == units_.begin() || offset >= (it - 1)->offset() + ((it - 1)->end_ - (it - 1)->begin_)) {
+            throw out_of_range("no unit contains offset " + std::to_string(offset));
+        }
+        return *(it - 1);
+    }
+
+    [[nodiscard]] die die_at(std::size_t offset) const
+    {
+        const auto &u = unit_at(offset);
+        return {&u, info_.data() + offset};
+    }
+
+private:
+    friend class unit;
+    friend class die;
+    friend class attribute;
+
+    // throws init_error if the section is `required` but missing, a missing optional section is empty
+    section load_section(const char *name, bool required);
+    [[nodiscard]] bool little_endian() const;
+
+    Dwarf_Debug dbg_;
+    std::string path_;
+    const elf_object *object_; // set if the debug preloaded its sections, they are borrowed from it then
+    std::unique_ptr<mapped_file> file_; // mapped by the first section read from the file, the others share it
+    section info_;
+    section str_;
+    section str_offsets_;
+    section line_str_;
+    std::vector<unit> units_;
+};
+
+inline abbreviation_table::abbreviation_table(Dwarf_Debug dbg, std::uint64_t offset)
+{
+    std::uint64_t entries = 0;
+    while (true) {
+        Dwarf_Abbrev abbrev = nullptr;
+        Dwarf_Unsigned length = 0;
+        Dwarf_Unsigned attr_count = 0;
+        dwarf_error error(dbg);
+        int res = dwarf_get_abbrev(dbg, offset, &abbrev, &length, &attr_count, error.out());
+        if (res == DW_DLV_NO_ENTRY) {
+            break;
+        }
+        if (res != DW_DLV_OK) {
+            throw other_error("dwarf_get_abbrev failed!");
+        }
+        auto fail = [&](const char *message) {
+            dwarf_dealloc(dbg, abbrev, DW_DLA_ABBREV);
+            throw other_error(message);
+        };
+
+        abbreviation entry;
+        Dwarf_Unsigned code = 0;
+        if (dwarf_get_abbrev_code(abbrev, &code, error.out()) != DW_DLV_OK) {
+            fail("dwarf_get_abbrev_code failed!");
+        }
+        if (code == 0) {
+            // the null entry ending the table
+            dwarf_dealloc(dbg, abbrev, DW_DLA_ABBREV);
+            break;
+        }
+        entry.code = code;
+
+        Dwarf_Half tag = 0;
+        if (dwarf_get_abbrev_tag(abbrev, &tag, error.out()) != DW_DLV_OK) {
+            fail("dwarf_get_abbrev_tag failed!");
+        }
+        entry.tag = static_cast<cppdwarf::tag>(tag);
+
+        Dwarf_Signed has_children = 0;
+        if (dwarf_get_abbrev_children_flag(abbrev, &has_children, error.out()) != DW_DLV_OK) {
+            fail("dwarf_get_abbrev_children_flag failed!");
+        }
+        entry.has_children = has_children != 0;
+
+        for (Dwarf_Unsigned i = 0; i < attr_count; i++) {
+            Dwarf_Unsigned attr_num = 0;
+            Dwarf_Unsigned form = 0;
+            Dwarf_Signed implicit_const = 0;
+            Dwarf_Off entry_offset = 0;
+            if (dwarf_get_abbrev_entry_b(abbrev, i, false, &attr_num, &form, &implicit_const, &entry_offset,
+                                         error.out()) != DW_DLV_OK) {
+                fail("dwarf_get_abbrev_entry_b failed!");
+            }
+            if (attr_num == DW_AT_sibling) {
+                entry.sibling_index = static_cast<int>(entry.attributes.size());
+            }
+            entry.attributes.push_back(
+                {static_cast<attribute_t>(attr_num), static_cast<cppdwarf::form>(form), implicit_const});
+        }
+        dwarf_dealloc(dbg, abbrev, DW_DLA_ABBREV);
+
+        if (code <= 2 * entries + dense_slack) {
+            if (code > abbreviations_.size()) {
+                abbreviations_.resize(code);
+            }
+            abbreviations_[code - 1] = std::move(entry);
+        }
+        else {
+            sparse_[code] = std::move(entry);
+        }
+        ++entries;
+        offset += length;
+    }
+}
+
+inline native::die unit::die() const
+{
+    return {this, first_die_};
+}
+
+inline std::vector<std::string> unit::src_files() const
+{
+    Dwarf_Die raw_die = nullptr;
+    dwarf_error error(reader_->dbg_);
+    int res = dwarf_offdie_b(reader_->dbg_, die().offset(), true, &raw_die, error.out());
+    if (res != DW_DLV_OK) {
+        throw other_error("dwarf_offdie_b failed!");
+    }
+    return cppdwarf::die(reader_->dbg_, raw_die, true).src_files();
+}
+
+inline std::vector<std::string> unit::src_files(const debug &dbg) const
+{
+    Dwarf_Die raw_die = nullptr;
+    dwarf_error error(dbg.handle());
+    int res = dwarf_offdie_b(dbg.handle(), die().offset(), true, &raw_die, error.out());
+    if (res != DW_DLV_OK) {
+        throw other_error("dwarf_offdie_b failed!");
+    }
+    return cppdwarf::die(dbg.handle(), raw_die, true).src_files();
+}
+
+inline cursor attribute::value() const
+{
+    return {value_, unit_->end_};
+}
+
+inline std::size_t attribute::reference() const
+{
+    auto c = value();
+    switch (form_) {
+    case form::ref1:
+        return unit_->offset_ + c.fixed(1);
+    case form::ref2:
+        return unit_->offset_ + c.fixed(2);
+    case form::ref4:
+        return unit_->offset_ + c.fixed(4);
+    case form::ref8:
+        return unit_->offset_ + c.fixed(8);
+    case form::ref_udata:
+        return unit_->offset_ + c.uleb128();
+    case form::ref_addr:
+        return c.fixed(unit_->version_ <= 2 ? unit_->address_size_ : unit_->offset_size_);
+    default:
+        throw type_error("not a reference to a DIE in .debug_info");
+    }
+}
+
+inline std::string_view attribute::get_string() const
+{
+    const auto &sections = *unit_->reader_;
+    auto c = value();
+    std::uint64_t index = 0;
+    switch (form_) {
+    case form::string:
+        return c.cstring();
+    case form::strp:
+        return sections.str_.string_at(c.fixed(unit_->offset_size_));
+    case form::line_strp:
+        return sections.line_str_.string_at(c.fixed(unit_->offset_size_));
+    case form::strx:
+    case form::GNU_str_index:
+        index = c.uleb128();
+        break;
+    case form::strx1:
+        index = c.fixed(1);
+        break;
+    case form::strx2:
+        index = c.fixed(2);
+        break;
+    case form::strx3:
+        index = c.fixed(3);
+        break;
+    case form::strx4:
+        index = c.fixed(4);
+        break;
+    default:
+        throw type_error("not a string");
+    }
+
+    // indexed strings go through the unit's contribution to .debug_str_offsets
+    const auto entry = unit_->str_offsets_base_ + index * unit_->offset_size_;
+    if (entry + unit_->offset_size_ > sections.str_offsets_.size()) {
+        throw other_error("string index out of range");
+    }
+    cursor offsets(sections.str_offsets_.data() + entry, sections.str_offsets_.end());
+    return sections.str_.string_at(offsets.fixed(unit_->offset_size_));
+}
+
+inline std::int64_t attribute::get_integer() const
+{
+    auto c = value();
+    switch (form_) {
+    case form::data1:
+        return static_cast<std::int64_t>(c.fixed(1));
+    case form::data2:
+        return static_cast<std::int64_t>(c.fixed(2));
+    case form::data4:
+        return static_cast<std::int64_t>(c.fixed(4));
+    case form::data8:
+        return static_cast<std::int64_t>(c.fixed(8));
+    case form::udata:
+        return static_cast<std::int64_t>(c.uleb128());
+    case form::sdata:
+        return c.sleb128();
+    case form::implicit_const:
+        return spec_->implicit_const;
+    default:
+        throw type_error("not an integer");
+    }
+}
+
+template <>
+[[nodiscard]] inline std::string attribute::get<std::string>() const
+{
+    return std::string(get_string());
+}
+
+template <>
+[[nodiscard]] inline std::string_view attribute::get<std::string_view>() const
+{
+    return get_string();
+}
+
+template <>
+[[nodiscard]] inline bool attribute::get<bool>() const
+{
+    return get_flag();
+}
+
+template <>
+[[nodiscard]] inline int attribute::get<int>() const
+{
+    return static_cast<int>(get_integer());
+}
+
+template <>
+[[nodiscard]] inline std::int64_t attribute::get<std::int64_t>() const
+{
+    return get_integer();
+}
+
+template <>
+[[nodiscard]] inline std::uint64_t attribute::get<std::uint64_t>() const
+{
+    return static_cast<std::uint64_t>(get_integer());
+}
+
+template <>
+[[nodiscard]] inline die attribute::get<die>() const
+{
+    return unit_->reader_->die_at(reference());
+}
+
+inline std::pair<const std::uint8_t *, std::size_t> attribute::block() const
+{
+    auto c = value();
+    std::uint64_t size = 0;
+    switch (form_) {
+    case form::block1:
+        size = c.fixed(1);
+        break;
+    case form::block2:
+        size = c.fixed(2);
+        break;
+    case form::block4:
+        size = c.fixed(4);
+        break;
+    case form::block:
+    case form::exprloc:
+        size = c.uleb128();
+        break;
+    default:
+        throw type_error("not a block");
+    }
+    const auto *data = c.position();
+    c.skip(size);
+    return {data, static_cast<std::size_t>(size)};
+}
+
+inline void attribute_list::skip_value(cursor &c, cppdwarf::form form, const unit &u)
+{
+    if (const auto size = fixed_size(form)) {
+        c.skip(*size);
+        return;
+    }
+    switch (form) {
+    case form::udata:
+    case form::ref_udata:
+    case form::strx:
+    case form::addrx:
+    case form::loclistx:
+    case form::rnglistx:
+    case form::GNU_str_index:
+    case form::GNU_addr_index:
+    case form::sdata:
+        c.skip_leb128();
+        break;
+    case form::addr:
+        c.skip(u.address_size_);
+        break;
+    case form::ref_addr:
+        c.skip(u.version_ <= 2 ? u.address_size_ : u.offset_size_);
+        break;
+    case form::strp:
+    case form::line_strp:
+    case form::sec_offset:
+    case form::strp_sup:
+    case form::GNU_strp_alt:
+    case form::GNU_ref_alt:
+        c.skip(u.offset_size_);
+        break;
+    case form::string:
+        c.cstring();
+        break;
+    case form::block1:
+        c.skip(c.fixed(1));
+        break;
+    case form::block2:
+        c.skip(c.fixed(2));
+        break;
+    case form::block4:
+        c.skip(c.fixed(4));
+        break;
+    case form::block:
+    case form::exprloc:
+        c.skip(c.uleb128());
+        break;
+    case form::indirect:
+        skip_value(c, static_cast<cppdwarf::form>(c.uleb128()), u);
+        break;
+    default:
+        throw other_error("unsupported form " + std::to_string(static_cast<int>(form)));
+    }
+}
+
+inline std::size_t die::offset() const
+{
+    return pos_ - unit_->reader_->info_.data();
+}
+
+inline const std::uint8_t *die::next_sibling() const
+{
+    const auto *end = attributes_end();
+    if (abbrev_->sibling_index >= 0) {
+        auto it = attributes().begin();
+        for (int i = 0; i < abbrev_->sibling_index; i++) {
+            ++it;
+        }
+        if (it->is_reference()) {
+            // only a sibling after this DIE's attributes and within the unit is followed: one pointing back would make
+            // the iteration loop, one outside the unit would read past it
+            const auto *info = unit_->reader_->info_.data();
+            const auto sibling = it->reference();
+            if (sibling > static_cast<std::size_t>(end - info) &&
+                sibling < static_cast<std::size_t>(unit_->end_ - info)) {
+                return info + sibling;
+            }
+        }
+    }
+
+    // no usable DW_AT_sibling, step over the children one by one
+    const auto *pos = end;
+    if (!abbrev_->has_children) {
+        return pos;
+    }
+    for (std::size_t depth = 1; depth > 0;) {
+        const die child(unit_, pos);
+        if (child.is_null()) {
+            --depth;
+            pos = child.attributes_;
+            continue;
+        }
+        pos = child.attributes_end();
+        if (child.has_children()) {
+            ++depth;
+        }
+    }
+    return pos;
+}
+
+inline die::const_iterator die::begin() const
+{
+    if (!has_children()) {
+        return {};
+    }
+    return {die(unit_, attributes_end()), nullptr};
+}
+
+inline die::const_iterator die::end() const
+{
+    return {};
+}
+
+inline die::const_iterator die::begin(const tag_set &tags) const
+{
+    if (!has_children()) {
+        return {};
+    }
+    return {die(unit_, attributes_end()), &tags};
+}
+
+inline die::filtered_children die::children(const tag_set &tags) const
+{
+    return {*this, tags};
+}
+
+inline reader::reader(const debug &dbg) : dbg_(dbg.handle()), path_(dbg.path()), object_(dbg.object())
+{
+    if (!little_endian()) {
+        throw init_error(path_ + " is big-endian, which the native reader does not support");
+    }
+    info_ = load_section(".debug_info", true);
+    str_ = load_section(".debug_str", false);
+    str_offsets_ = load_section(".debug_str_offsets", false);
+    line_str_ = load_section(".debug_line_str", false);
+
+    std::unordered_map<std::uint64_t, std::shared_ptr<const abbreviation_table>> tables;
+    const auto *pos = info_.data();
+    while (pos < info_.end()) {
+        cursor c(pos, info_.end());
+        unit u;
+        u.reader_ = this;
+        u.offset_ = pos - info_.data();
+        u.begin_ = pos;
+
+        std::uint64_t length = c.fixed(4);
+        u.offset_size_ = 4;
+        if (length == 0xffffffff) {
+            length = c.fixed(8);
+            u.offset_size_ = 8;
+        }
+        else if (length >= 0xfffffff0) {
+            throw init_error("reserved unit length in .debug_info");
+        }
+        c.skip(length); // bounds check
+        u.end_ = c.position();
+
+        cursor header(u.begin_ + (u.offset_size_ == 4 ? 4 : 12), u.end_);
+        u.version_ = static_cast<int>(header.fixed(2));
+        if (u.version_ < 2 || u.version_ > 5) {
+            throw init_error("unsupported DWARF version " + std::to_string(u.version_) +
+                             ", the native reader only supports little-endian DWARF 2 to 5");
+        }
+        std::uint64_t abbrev_offset = 0;
+        if (u.version_ >= 5) {
+            u.unit_type_ = static_cast<int>(header.fixed(1));
+            u.address_size_ = static_cast<int>(header.fixed(1));
+            abbrev_offset = header.fixed(u.offset_size_);
+            switch (u.unit_type_) {
+            case DW_UT_skeleton:
+            case DW_UT_split_compile:
+                header.skip(8); // dwo_id
+                break;
+            case DW_UT_type:
+            case DW_UT_split_type:
+                header.skip(8 + u.offset_size_); // type signature and offset
+                break;
+            default:
+                break;
+            }
+        }
+        else {
+            u.unit_type_ = DW_UT_compile;
+            abbrev_offset = header.fixed(u.offset_size_);
+            u.address_size_ = static_cast<int>(header.fixed(1));
+        }
+        u.first_die_ = header.position();
+
+        auto &table = tables[abbrev_offset];
+        if (!table) {
+            table = std::make_shared<const abbreviation_table>(dbg_, abbrev_offset);
+        }
+        u.abbreviations_ = table;
+        units_.push_back(std::move(u));
+        pos = units_.back().end_;
+    }
+
+    // the base of each unit's string offsets, needed to decode DW_FORM_strx
+    for (auto &u : units_) {
+        if (u.version_ >= 5) {
+            u.str_offsets_base_ = u.offset_size_ == 4 ? 8 : 16; // right after the first contribution's header
+        }
+        const auto root = u.die();
+        if (root.is_null()) {
+            continue;
+        }
+        for (const auto &attr : root.attributes()) {
+            if (attr.type() == attribute_t::str_offsets_base) {
+                u.str_offsets_base_ = attr.value().fixed(u.offset_size_);
+            }
+        }
+    }
+}
+
+inline section reader::load_section(const char *name, bool required)
+{
+    if (object_) {
+        const auto *data = object_->section_data(name);
+        if (!data && required) {
+            throw init_error(path_ + " has no " + name + " section");
+        }
+        return data ? section(data->data(), data->size()) : section();
+    }
+
+    Dwarf_Addr addr = 0;
+    Dwarf_Unsigned size = 0;
+    Dwarf_Unsigned flags = 0;
+    Dwarf_Unsigned file_offset = 0;
+    dwarf_error error(dbg_);
+    int res = dwarf_get_section_info_by_name_a(dbg_, name, &addr, &size, &flags, &file_offset, error.out());
+    if (res == DW_DLV_NO_ENTRY) {
+        if (required) {
+            throw init_error(path_ + " has no " + name + " section");
+        }
+        return {};
+    }
+    if (res != DW_DLV_OK) {
+        throw init_error(std::string("dwarf_get_section_info_by_name_a failed for ") + name);
+    }
+    constexpr Dwarf_Unsigned shf_compressed = 0x800;
+    if (flags & shf_compressed) {
+        throw init_error(std::string(name) + " is compressed, which the native reader does not support");
+    }
+
+    if (!file_) {
+        file_ = std::make_unique<mapped_file>(path_);
+    }
+    if (file_offset > file_->size() || size > file_->size() - file_offset) {
+        throw init_error(std::string(name) + " extends past the end of " + path_);
+    }
+    return {file_->data() + file_offset, static_cast<std::size_t>(size)};
+}
+
+// The reader decodes fixed-size values in host byte order, so both the host and the object have to be little-endian
+inline bool reader::little_endian() const
+{
+    const std::uint16_t one = 1;
+    std::uint8_t first = 0;
+    std::memcpy(&first, &one, 1);
+    if (first != 1) {
+        return false;
+    }
+    if (object_) {
+        return !object_->big_endian();
+    }
+    // libdwarf byte-swaps what it reads when the object's byte order differs from the host's
+    auto *copy = dwarf_get_endian_copy_function(dbg_);
+    if (!copy) {
+        return false;
+    }
+    const std::uint8_t probe[2] = {1, 0};
+    std::uint8_t copied[2] = {};
+    copy(copied, probe, sizeof(probe));
+    return copied[0] == 1;
+}
+
+} // namespace cppdwarf::native
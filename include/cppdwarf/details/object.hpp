@@ -0,0 +1,494 @@
+#pragma once
+
+#include <dwarf.h>
+#include <libdwarf.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#ifdef CPPDWARF_ZLIB
+#include <zlib.h>
+#endif
+#ifdef CPPDWARF_ZSTD
+#include <zstd.h>
+#endif
+
+#include <cppdwarf/details/exceptions.hpp>
+
+namespace cppdwarf {
+
+// How long reading (and decompressing) one section took, see debug::section_load_times()
+struct section_load_time {
+    std::string name;
+    std::size_t file_size = 0; // bytes in the file, compressed or not
+    std::size_t size = 0;      // bytes handed to libdwarf
+    std::chrono::nanoseconds elapsed{};
+};
+
+// An ELF file whose section table is read by cppdwarf rather than libdwarf, served to libdwarf through its object
+// access interface. All .debug_* and .zdebug_* sections are read up front and the compressed ones, SHF_COMPRESSED
+// (zlib or zstd) and GNU .zdebug_* (zlib), are decompressed concurrently on a pool of threads into buffers the object
+// owns. libdwarf then sees plain .debug_* sections and does not decompress anything itself; other sections are only
+// read when libdwarf asks for them.
+//
+// Decompression needs zlib (CPPDWARF_ZLIB) and zstd (CPPDWARF_ZSTD), which the CMake build enables when it finds
+// them. Relocations are not applied, so relocatable object files are rejected like any file that is not ELF, with an
+// init_error; debug then falls back to dwarf_init_path().
+class elf_object {
+public:
+    // threads == 0 uses one thread per hardware thread
+    explicit elf_object(const std::string &path, unsigned threads = 0) : path_(path)
+    {
+        std::ifstream file(path_, std::ios::binary | std::ios::ate);
+        if (!file) {
+            throw init_error("failed to open " + path_);
+        }
+        file_size_ = static_cast<std::uint64_t>(file.tellg());
+        read_headers(file);
+        preload(threads);
+    }
+
+    // libdwarf keeps a pointer to the object
+    elf_object(const elf_object &) = delete;
+    elf_object &operator=(const elf_object &) = delete;
+    elf_object(elf_object &&) = delete;
+    elf_object &operator=(elf_object &&) = delete;
+
+    // the interface to pass to dwarf_object_init_b(), valid for the lifetime of the object
+    [[nodiscard]] Dwarf_Obj_Access_Interface_a *access_interface()
+    {
+        return &access_interface_;
+    }
+
+    [[nodiscard]] bool big_endian() const
+    {
+        return big_endian_;
+    }
+
+    // the preloaded sections, in the order they finished loading
+    [[nodiscard]] const std::vector<section_load_time> &load_times() const
+    {
+        return load_times_;
+    }
+
+    // The bytes of a preloaded section as libdwarf sees them: decompressed and, for .zdebug_* sections, under their
+    // .debug_* name. nullptr if there is no such section.
+    [[nodiscard]] const std::vector<std::uint8_t> *section_data(std::string_view name) const
+    {
+        for (const auto &s : sections_) {
+            if (s.preload && s.name == name) {
+                return &s.data;
+            }
+        }
+        return nullptr;
+    }
+
+    // the memory of the section buffers, the preloaded ones and those libdwarf asked for since
+    [[nodiscard]] std::size_t memory() const
+    {
+        std::size_t bytes = 0;
+        for (const auto &s : sections_) {
+            bytes += s.data.capacity();
+        }
+        return bytes;
+    }
+
+private:
+    enum class compression { none, zlib, zstd, zlib_gnu };
+
+    struct section {
+        std::string name;
+        Dwarf_Unsigned type = 0;
+        Dwarf_Unsigned flags = 0;
+        Dwarf_Addr addr = 0;
+        Dwarf_Unsigned offset = 0;
+        Dwarf_Unsigned file_size = 0; // sh_size, the size in the file
+        Dwarf_Unsigned size = 0;      // the size once decompressed
+        Dwarf_Unsigned link = 0;
+        Dwarf_Unsigned info = 0;
+        Dwarf_Unsigned entsize = 0;
+        compression method = compression::none;
+        bool preload = false;
+        bool loaded = false;
+        std::vector<std::uint8_t> data;
+    };
+
+    // An init_error with the libdwarf error number load_section() reports it with
+    class load_error : public init_error {
+    public:
+        load_error(const std::string &message, int dwarf_error) : init_error(message), dwarf_error_(dwarf_error) {}
+
+        [[nodiscard]] int dwarf_error() const
+        {
+            return dwarf_error_;
+        }
+
+    private:
+        int dwarf_error_;
+    };
+
+    static constexpr Dwarf_Unsigned sht_nobits = 8;
+    static constexpr Dwarf_Unsigned shf_compressed = 0x800;
+    static constexpr std::uint16_t et_rel = 1;
+    // Deflate cannot compress better than about 1032:1, a section claiming to grow more than this is corrupt, and
+    // allocating what its header says could exhaust the memory. zstd can do better on long runs of the same byte,
+    // which debug sections do not have.
+    static constexpr std::uint64_t max_compression_ratio = 1032;
+
+    [[nodiscard]] std::uint64_t read_uint(const std::uint8_t *p, std::size_t size) const
+    {
+        std::uint64_t value = 0;
+        for (std::size_t i = 0; i < size; ++i) {
+            const auto byte = big_endian_ ? p[i] : p[size - 1 - i];
+            value = (value << 8) | byte;
+        }
+        return value;
+    }
+
+    std::vector<std::uint8_t> read_bytes(std::ifstream &file, std::uint64_t offset, std::uint64_t size) const
+    {
+        if (offset > file_size_ || size > file_size_ - offset) {
+            throw load_error("section data beyond the end of " + path_, DW_DLE_READ_ERROR);
+        }
+        std::vector<std::uint8_t> bytes(size);
+        file.seekg(static_cast<std::streamoff>(offset));
+        file.read(reinterpret_cast<char *>(bytes.data()), static_cast<std::streamsize>(size));
+        if (!file) {
+            throw load_error("failed to read " + path_, DW_DLE_READ_ERROR);
+        }
+        return bytes;
+    }
+
+    void read_headers(std::ifstream &file)
+    {
+        if (file_size_ < 52) {
+            throw init_error(path_ + " is not an ELF file");
+        }
+        const auto ident = read_bytes(file, 0, 16);
+        if (ident[0] != 0x7f || ident[1] != 'E' || ident[2] != 'L' || ident[3] != 'F' || ident[4] < 1 ||
+            ident[4] > 2 || ident[5] < 1 || ident[5] > 2) {
+            throw init_error(path_ + " is not an ELF file");
+        }
+        is_64_ = ident[4] == 2;
+        big_endian_ = ident[5] == 2;
+
+        const auto header = read_bytes(file, 0, is_64_ ? 64 : 52);
+        if (read_uint(&header[16], 2) == et_rel) {
+            throw init_error(path_ + " is a relocatable object file");
+        }
+        const auto shoff = is_64_ ? read_uint(&header[40], 8) : read_uint(&header[32], 4);
+        const auto shentsize = read_uint(&header[is_64_ ? 58 : 46], 2);
+        std::uint64_t shnum = read_uint(&header[is_64_ ? 60 : 48], 2);
+        std::uint64_t shstrndx = read_uint(&header[is_64_ ? 62 : 50], 2);
+        if (shoff == 0 || shentsize < (is_64_ ? 64U : 40U)) {
+            throw init_error(path_ + " has no section table");
+        }
+
+        // with many sections, the count and the string table index are kept in section 0 (SHN_XINDEX)
+        auto first = parse_header(read_bytes(file, shoff, shentsize).data());
+        if (shnum == 0) {
+            shnum = first.file_size;
+        }
+        if (shstrndx == 0xffff) {
+            shstrndx = first.link;
+        }
+        if (shnum > (file_size_ - std::min(shoff, file_size_)) / shentsize || shstrndx >= shnum) {
+            throw init_error(path_ + " has a corrupt section table");
+        }
+
+        const auto table = read_bytes(file, shoff, shnum * shentsize);
+        std::vector<std::uint32_t> name_offsets;
+        for (std::uint64_t i = 0; i < shnum; ++i) {
+            const auto *p = &table[i * shentsize];
+            name_offsets.push_back(static_cast<std::uint32_t>(read_uint(p, 4)));
+            sections_.push_back(parse_header(p));
+        }
+        const auto &strtab = sections_[shstrndx];
+        const auto names = read_bytes(file, strtab.offset, strtab.file_size);
+
+        bool has_info = false;
+        for (std::size_t i = 0; i < sections_.size(); ++i) {
+            auto &s = sections_[i];
+            const auto offset = name_offsets[i];
+            if (offset < names.size()) {
+                const auto *begin = reinterpret_cast<const char *>(names.data()) + offset;
+                s.name.assign(begin, ::strnlen(begin, names.size() - offset));
+            }
+            const bool debug = s.name.rfind(".debug_", 0) == 0;
+            const bool zdebug = s.name.rfind(".zdebug_", 0) == 0;
+            s.preload = (debug || zdebug) && s.type != sht_nobits;
+            if (zdebug) {
+                s.name.erase(1, 1); // libdwarf gets the decompressed bytes, under the .debug_* name
+                s.method = compression::zlib_gnu;
+            }
+            has_info |= s.preload && s.name == ".debug_info";
+        }
+        if (!has_info) {
+            // e.g. a stripped binary pointing to a separate debug file, which only dwarf_init_path() looks for
+            throw init_error(path_ + " has no .debug_info section");
+        }
+    }
+
+    [[nodiscard]] section parse_header(const std::uint8_t *p) const
+    {
+        section s;
+        s.type = read_uint(p + 4, 4);
+        if (is_64_) {
+            s.flags = read_uint(p + 8, 8);
+            s.addr = read_uint(p + 16, 8);
+            s.offset = read_uint(p + 24, 8);
+            s.file_size = read_uint(p + 32, 8);
+            s.link = read_uint(p + 40, 4);
+            s.info = read_uint(p + 44, 4);
+            s.entsize = read_uint(p + 56, 8);
+        }
+        else {
+            s.flags = read_uint(p + 8, 4);
+            s.addr = read_uint(p + 12, 4);
+            s.offset = read_uint(p + 16, 4);
+            s.file_size = read_uint(p + 20, 4);
+            s.link = read_uint(p + 24, 4);
+            s.info = read_uint(p + 28, 4);
+            s.entsize = read_uint(p + 36, 4);
+        }
+        s.size = s.file_size;
+        return s;
+    }
+
+    // Reads the debug sections, largest first, on up to `threads` threads. The compressed sizes are known from the
+    // section table, so a thread that picks up a small section does not wait for a large one.
+    void preload(unsigned threads)
+    {
+        std::vector<section *> tasks;
+        for (auto &s : sections_) {
+            if (s.preload) {
+                tasks.push_back(&s);
+            }
+        }
+        std::sort(tasks.begin(), tasks.end(), [](const auto *a, const auto *b) { return a->file_size > b->file_size; });
+
+        if (threads == 0) {
+            threads = std::max(1U, std::thread::hardware_concurrency());
+        }
+        std::atomic<std::size_t> next{0};
+        std::mutex mutex;
+        std::exception_ptr error;
+        auto worker = [&]() {
+            std::ifstream file(path_, std::ios::binary);
+            for (auto i = next++; i < tasks.size(); i = next++) {
+                try {
+                    const auto start = std::chrono::steady_clock::now();
+                    load(file, *tasks[i]);
+                    const auto elapsed = std::chrono::steady_clock::now() - start;
+                    std::lock_guard lock(mutex);
+                    load_times_.push_back({tasks[i]->name, static_cast<std::size_t>(tasks[i]->file_size),
+                                           tasks[i]->data.size(), elapsed});
+                }
+                catch (...) {
+                    std::lock_guard lock(mutex);
+                    if (!error) {
+                        error = std::current_exception();
+                    }
+                    next = tasks.size(); // stop the other workers
+                }
+            }
+        };
+
+        const auto num_threads = std::min<std::size_t>(threads, tasks.size());
+        std::vector<std::thread> pool;
+        for (std::size_t i = 1; i < num_threads; ++i) {
+            pool.emplace_back(worker);
+        }
+        worker();
+        for (auto &thread : pool) {
+            thread.join();
+        }
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    void load(std::ifstream &file, section &s) const
+    {
+        if (!file) {
+            throw load_error("failed to open " + path_, DW_DLE_READ_ERROR);
+        }
+        auto bytes = read_bytes(file, s.offset, s.file_size);
+        if (s.method == compression::zlib_gnu) {
+            // "ZLIB" followed by the decompressed size as a 64-bit big-endian number
+            if (bytes.size() < 12 || std::string_view(reinterpret_cast<const char *>(bytes.data()), 4) != "ZLIB") {
+                // the GNU tools only compress a .zdebug_* section when that makes it smaller
+                s.data = std::move(bytes);
+                s.method = compression::none;
+            }
+            else {
+                std::uint64_t size = 0;
+                for (std::size_t i = 4; i < 12; ++i) {
+                    size = (size << 8) | bytes[i];
+                }
+                s.data = decompress(s, compression::zlib_gnu, bytes.data() + 12, bytes.size() - 12, size);
+            }
+        }
+        else if (s.flags & shf_compressed) {
+            // Elf32_Chdr / Elf64_Chdr: ch_type, (ch_reserved,) ch_size, ch_addralign
+            const std::size_t header_size = is_64_ ? 24 : 12;
+            if (bytes.size() < header_size) {
+                throw load_error(s.name + " has a truncated compression header", DW_DLE_ZLIB_DATA_ERROR);
+            }
+            const auto type = read_uint(bytes.data(), 4);
+            const auto size = is_64_ ? read_uint(bytes.data() + 8, 8) : read_uint(bytes.data() + 4, 4);
+            const auto method = type == 1 ? compression::zlib : type == 2 ? compression::zstd : compression::none;
+            if (method == compression::none) {
+                throw load_error(s.name + " uses unknown compression type " + std::to_string(type),
+                                 DW_DLE_ZLIB_DATA_ERROR);
+            }
+            s.data = decompress(s, method, bytes.data() + header_size, bytes.size() - header_size, size);
+            s.flags &= ~shf_compressed;
+        }
+        else {
+            s.data = std::move(bytes);
+        }
+        s.size = s.data.size();
+        s.loaded = true;
+    }
+
+    static std::vector<std::uint8_t> decompress(const section &s, compression method, const std::uint8_t *data,
+                                                std::size_t size, std::uint64_t decompressed_size)
+    {
+        if (decompressed_size / max_compression_ratio > size) {
+            throw load_error(s.name + " claims to decompress from " + std::to_string(size) + " to " +
+                                 std::to_string(decompressed_size) + " bytes",
+                             DW_DLE_ZLIB_DATA_ERROR);
+        }
+        std::vector<std::uint8_t> result(decompressed_size);
+        if (method == compression::zstd) {
+#ifdef CPPDWARF_ZSTD
+            const auto res = ZSTD_decompress(result.data(), result.size(), data, size);
+            if (ZSTD_isError(res) || res != result.size()) {
+                throw load_error("failed to decompress " + s.name + ": " +
+                                     (ZSTD_isError(res) ? ZSTD_getErrorName(res) : "size mismatch"),
+                                 DW_DLE_ZLIB_DATA_ERROR);
+            }
+            return result;
+#else
+            throw init_error(s.name + " is compressed with zstd, build cppdwarf with CPPDWARF_ZSTD");
+#endif
+        }
+#ifdef CPPDWARF_ZLIB
+        auto length = static_cast<uLongf>(result.size());
+        if (::uncompress(result.data(), &length, data, static_cast<uLong>(size)) != Z_OK || length != result.size()) {
+            throw load_error("failed to decompress " + s.name, DW_DLE_ZLIB_DATA_ERROR);
+        }
+        return result;
+#else
+        static_cast<void>(data);
+        static_cast<void>(size);
+        throw init_error(s.name + " is compressed with zlib, build cppdwarf with CPPDWARF_ZLIB");
+#endif
+    }
+
+    // Dwarf_Obj_Access_Methods_a, called by libdwarf from the thread using the Dwarf_Debug
+
+    static int get_section_info(void *obj, Dwarf_Unsigned index, Dwarf_Obj_Access_Section_a *out, int *)
+    {
+        const auto &self = *static_cast<elf_object *>(obj);
+        if (index >= self.sections_.size()) {
+            return DW_DLV_NO_ENTRY;
+        }
+        const auto &s = self.sections_[index];
+        out->as_name = s.name.c_str();
+        out->as_type = s.type;
+        out->as_flags = s.flags;
+        out->as_addr = s.addr;
+        out->as_offset = s.offset;
+        out->as_size = s.size;
+        out->as_link = s.link;
+        out->as_info = s.info;
+        out->as_entrysize = s.entsize;
+        return DW_DLV_OK;
+    }
+
+    static Dwarf_Small get_byte_order(void *obj)
+    {
+        return static_cast<elf_object *>(obj)->big_endian_ ? DW_END_big : DW_END_little;
+    }
+
+    static Dwarf_Small get_length_size(void *)
+    {
+        return 4;
+    }
+
+    static Dwarf_Small get_pointer_size(void *obj)
+    {
+        return static_cast<elf_object *>(obj)->is_64_ ? 8 : 4;
+    }
+
+    static Dwarf_Unsigned get_filesize(void *obj)
+    {
+        return static_cast<elf_object *>(obj)->file_size_;
+    }
+
+    static Dwarf_Unsigned get_section_count(void *obj)
+    {
+        return static_cast<elf_object *>(obj)->sections_.size();
+    }
+
+    static int load_section(void *obj, Dwarf_Unsigned index, Dwarf_Small **data, int *error)
+    {
+        auto &self = *static_cast<elf_object *>(obj);
+        if (index >= self.sections_.size() || self.sections_[index].type == sht_nobits) {
+            return DW_DLV_NO_ENTRY;
+        }
+        auto &s = self.sections_[index];
+        std::lock_guard lock(self.mutex_);
+        if (!s.loaded) {
+            try {
+                std::ifstream file(self.path_, std::ios::binary);
+                self.load(file, s);
+            }
+            // the interface only passes an error number, libdwarf reports the failed load with it
+            catch (const load_error &err) {
+                *error = err.dwarf_error();
+                return DW_DLV_ERROR;
+            }
+            catch (const std::bad_alloc &) {
+                *error = DW_DLE_ALLOC_FAIL;
+                return DW_DLV_ERROR;
+            }
+            catch (...) {
+                *error = DW_DLE_READ_ERROR;
+                return DW_DLV_ERROR;
+            }
+        }
+        *data = s.data.data();
+        return DW_DLV_OK;
+    }
+
+    static constexpr Dwarf_Obj_Access_Methods_a methods_ = {
+        get_section_info, get_byte_order, get_length_size, get_pointer_size, get_filesize, get_section_count,
+        load_section,     nullptr,
+    };
+
+    std::string path_;
+    std::uint64_t file_size_ = 0;
+    bool is_64_ = false;
+    bool big_endian_ = false;
+    std::vector<section> sections_;
+    std::vector<section_load_time> load_times_;
+    std::mutex mutex_; // for the sections loaded on demand
+    Dwarf_Obj_Access_Interface_a access_interface_{this, &methods_};
+};
+
+} // namespace cppdwarf
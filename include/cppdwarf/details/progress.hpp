@@ -0,0 +1,176 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <utility>
+
+namespace cppdwarf {
+
+// How far a scan over the units has come, see scan_monitor
+struct scan_progress {
+    std::size_t units_done = 0;
+    std::size_t units_total = 0;  // 0 if unknown
+    std::uint64_t bytes_done = 0; // of .debug_info, the sizes of the units done added up
+    std::uint64_t bytes_total = 0;
+    std::uint64_t dies = 0; // DIEs visited by the walkers reporting to the monitor
+    bool finished = false;  // set on the report made by scan_monitor::finish()
+
+    // the share of .debug_info done, between 0 and 1
+    [[nodiscard]] double fraction() const
+    {
+        if (bytes_total == 0) {
+            return finished ? 1.0 : 0.0;
+        }
+        return std::min(1.0, static_cast<double>(bytes_done) / static_cast<double>(bytes_total));
+    }
+};
+
+// A flag to ask a scan to stop. Copies share the flag, so one copy can be handed to the scan and another one kept to
+// cancel it, from any thread. cancel() only stores to a lock-free atomic and may be called from a signal handler.
+class cancellation_token {
+public:
+    cancellation_token() : flag_(std::make_shared<std::atomic<bool>>(false)) {}
+
+    void cancel() const
+    {
+        flag_->store(true, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] bool cancelled() const
+    {
+        return flag_->load(std::memory_order_relaxed);
+    }
+
+private:
+    std::shared_ptr<std::atomic<bool>> flag_;
+};
+
+// Collects the progress of a scan and checks its cancellation token, for debug::compilation_units(scan_monitor &) and
+// the walkers (see basic_walker::set_monitor). The sink is called at most once per `interval`, and never
+// concurrently; everything else costs a few relaxed atomic operations per unit and per `die_interval` DIEs.
+//
+// A monitor may be shared by several threads scanning parts of the same file, e.g. with one debug object each: the
+// units done and DIEs visited add up, and whichever thread is due reports.
+class scan_monitor {
+public:
+    using sink = std::function<void(const scan_progress &)>;
+
+    // how many DIEs a walker visits between two checks
+    static constexpr std::size_t die_interval = 4096;
+
+    scan_monitor() = default;
+
+    explicit scan_monitor(sink on_progress, cancellation_token token = {},
+                          std::chrono::milliseconds interval = std::chrono::milliseconds(200))
+        : sink_(std::move(on_progress)), token_(std::move(token)), interval_(interval)
+    {
+    }
+
+    scan_monitor(const scan_monitor &) = delete;
+    scan_monitor &operator=(const scan_monitor &) = delete;
+
+    // Sets the totals progress is measured against. Repeating it with the same totals, e.g. once per worker, is fine.
+    void set_totals(std::size_t units, std::uint64_t bytes)
+    {
+        units_total_.store(units, std::memory_order_relaxed);
+        bytes_total_.store(bytes, std::memory_order_relaxed);
+    }
+
+    // Counts a unit of `bytes` bytes as done. Returns false if the scan has been cancelled and should stop.
+    bool unit_done(std::uint64_t bytes)
+    {
+        units_done_.fetch_add(1, std::memory_order_relaxed);
+        bytes_done_.fetch_add(bytes, std::memory_order_relaxed);
+        maybe_report();
+        return !cancelled();
+    }
+
+    // Counts `n` DIEs as visited. Returns false if the scan has been cancelled and should stop.
+    bool dies_visited(std::uint64_t n)
+    {
+        dies_.fetch_add(n, std::memory_order_relaxed);
+        maybe_report();
+        return !cancelled();
+    }
+
+    // reports the final progress, regardless of the interval
+    void finish()
+    {
+        auto p = progress();
+        p.finished = true;
+        report(p, true);
+    }
+
+    [[nodiscard]] bool cancelled() const
+    {
+        return token_.cancelled();
+    }
+
+    [[nodiscard]] const cancellation_token &token() const
+    {
+        return token_;
+    }
+
+    [[nodiscard]] scan_progress progress() const
+    {
+        scan_progress p;
+        p.units_done = units_done_.load(std::memory_order_relaxed);
+        p.units_total = units_total_.load(std::memory_order_relaxed);
+        p.bytes_done = bytes_done_.load(std::memory_order_relaxed);
+        p.bytes_total = bytes_total_.load(std::memory_order_relaxed);
+        p.dies = dies_.load(std::memory_order_relaxed);
+        return p;
+    }
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    void maybe_report()
+    {
+        if (!sink_) {
+            return;
+        }
+        const auto now = clock::now().time_since_epoch().count();
+        if (now < next_report_.load(std::memory_order_relaxed)) {
+            return;
+        }
+        next_report_.store(now + std::chrono::duration_cast<clock::duration>(interval_).count(),
+                           std::memory_order_relaxed);
+        report(progress(), false);
+    }
+
+    // a periodic report is skipped rather than waiting for another thread's report, the final one waits
+    void report(const scan_progress &p, bool wait)
+    {
+        if (!sink_) {
+            return;
+        }
+        while (reporting_.exchange(true, std::memory_order_acquire)) {
+            if (!wait) {
+                return;
+            }
+            std::this_thread::yield();
+        }
+        sink_(p);
+        reporting_.store(false, std::memory_order_release);
+    }
+
+    sink sink_;
+    cancellation_token token_;
+    std::chrono::milliseconds interval_{200};
+    std::atomic<std::size_t> units_done_{0};
+    std::atomic<std::size_t> units_total_{0};
+    std::atomic<std::uint64_t> bytes_done_{0};
+    std::atomic<std::uint64_t> bytes_total_{0};
+    std::atomic<std::uint64_t> dies_{0};
+    std::atomic<clock::rep> next_report_{0};
+    std::atomic<bool> reporting_{false};
+};
+
+} // namespace cppdwarf
@@ -0,0 +1,234 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+
+// Performance counters of the libdwarf wrappers. They are compiled in only when CPPDWARF_STATS is defined (the
+// CPPDWARF_STATS CMake option); otherwise every hook below is an empty inline function and costs nothing.
+namespace cppdwarf {
+
+// The libdwarf functions cppdwarf counts calls to
+enum class libdwarf_call {
+    next_cu_header_e,
+    child,
+    siblingof_c,
+    srcfiles,
+    offdie_b,
+    attrlist,
+    attr,
+    tag,
+    dieoffset,
+    die_CU_offset,
+    get_version_of_die,
+    whatattr,
+    whatform,
+    formstring,
+    formflag,
+    formudata,
+    formsdata,
+    formsig8,
+    global_formref_b,
+    srclines_b,
+    srclines_from_linecontext,
+    lineaddr,
+    line_srcfileno,
+    lineno,
+    lineoff_b,
+    lineendsequence,
+    lowpc,
+    highpc_b,
+    get_ranges_b,
+    rnglists_get_rle_head,
+    get_rnglists_entry_fields_a,
+};
+
+inline constexpr std::size_t libdwarf_call_count =
+    static_cast<std::size_t>(libdwarf_call::get_rnglists_entry_fields_a) + 1;
+
+constexpr const char *to_string(libdwarf_call call)
+{
+    constexpr const char *names[] = {
+        "dwarf_next_cu_header_e",
+        "dwarf_child",
+        "dwarf_siblingof_c",
+        "dwarf_srcfiles",
+        "dwarf_offdie_b",
+        "dwarf_attrlist",
+        "dwarf_attr",
+        "dwarf_tag",
+        "dwarf_dieoffset",
+        "dwarf_die_CU_offset",
+        "dwarf_get_version_of_die",
+        "dwarf_whatattr",
+        "dwarf_whatform",
+        "dwarf_formstring",
+        "dwarf_formflag",
+        "dwarf_formudata",
+        "dwarf_formsdata",
+        "dwarf_formsig8",
+        "dwarf_global_formref_b",
+        "dwarf_srclines_b",
+        "dwarf_srclines_from_linecontext",
+        "dwarf_lineaddr",
+        "dwarf_line_srcfileno",
+        "dwarf_lineno",
+        "dwarf_lineoff_b",
+        "dwarf_lineendsequence",
+        "dwarf_lowpc",
+        "dwarf_highpc_b",
+        "dwarf_get_ranges_b",
+        "dwarf_rnglists_get_rle_head",
+        "dwarf_get_rnglists_entry_fields_a",
+    };
+    static_assert(std::size(names) == libdwarf_call_count);
+    return names[static_cast<std::size_t>(call)];
+}
+
+// Only these calls are timed, they are where a walk over the DIEs spends its time inside libdwarf. Timing the cheap
+// per-attribute calls would cost more than the calls themselves.
+constexpr bool is_timed(libdwarf_call call)
+{
+    return call == libdwarf_call::next_cu_header_e || call == libdwarf_call::child ||
+           call == libdwarf_call::siblingof_c || call == libdwarf_call::srcfiles || call == libdwarf_call::srclines_b;
+}
+
+// A snapshot of the counters, see debug::stats()
+struct perf_stats {
+    bool enabled = false; // false if cppdwarf was built without CPPDWARF_STATS, all counters are zero then
+    std::uint64_t dies = 0;                  // die objects created
+    std::uint64_t attribute_lists = 0;       // attribute lists built
+    std::uint64_t reference_resolutions = 0; // references followed to the DIE they point to
+    std::uint64_t string_copies = 0;         // strings copied out of libdwarf into a std::string
+    std::array<std::uint64_t, libdwarf_call_count> calls{};
+    std::array<std::chrono::nanoseconds, libdwarf_call_count> time{}; // zero for the calls that are not timed
+
+    [[nodiscard]] std::uint64_t call_count(libdwarf_call call) const
+    {
+        return calls[static_cast<std::size_t>(call)];
+    }
+
+    [[nodiscard]] std::chrono::nanoseconds time_in(libdwarf_call call) const
+    {
+        return time[static_cast<std::size_t>(call)];
+    }
+};
+
+namespace details {
+
+enum class counter {
+    dies,
+    attribute_lists,
+    reference_resolutions,
+    string_copies,
+};
+
+#ifdef CPPDWARF_STATS
+// Process-wide, the counters of all debug objects and threads add up. Relaxed increments are enough for statistics.
+class perf_counters {
+public:
+    static perf_counters &instance()
+    {
+        static perf_counters counters;
+        return counters;
+    }
+
+    void add(counter c, std::uint64_t n = 1)
+    {
+        counters_[static_cast<std::size_t>(c)].fetch_add(n, std::memory_order_relaxed);
+    }
+
+    void add_call(libdwarf_call call)
+    {
+        calls_[static_cast<std::size_t>(call)].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void add_time(libdwarf_call call, std::chrono::nanoseconds elapsed)
+    {
+        time_[static_cast<std::size_t>(call)].fetch_add(elapsed.count(), std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] perf_stats snapshot() const
+    {
+        perf_stats stats;
+        stats.enabled = true;
+        stats.dies = load(counter::dies);
+        stats.attribute_lists = load(counter::attribute_lists);
+        stats.reference_resolutions = load(counter::reference_resolutions);
+        stats.string_copies = load(counter::string_copies);
+        for (std::size_t i = 0; i < libdwarf_call_count; ++i) {
+            stats.calls[i] = calls_[i].load(std::memory_order_relaxed);
+            stats.time[i] = std::chrono::nanoseconds(time_[i].load(std::memory_order_relaxed));
+        }
+        return stats;
+    }
+
+    void reset()
+    {
+        for (auto &c : counters_) {
+            c.store(0, std::memory_order_relaxed);
+        }
+        for (std::size_t i = 0; i < libdwarf_call_count; ++i) {
+            calls_[i].store(0, std::memory_order_relaxed);
+            time_[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+private:
+    [[nodiscard]] std::uint64_t load(counter c) const
+    {
+        return counters_[static_cast<std::size_t>(c)].load(std::memory_order_relaxed);
+    }
+
+    std::array<std::atomic<std::uint64_t>, 4> counters_{};
+    std::array<std::atomic<std::uint64_t>, libdwarf_call_count> calls_{};
+    std::array<std::atomic<std::int64_t>, libdwarf_call_count> time_{};
+};
+#endif
+
+inline void count([[maybe_unused]] counter c, [[maybe_unused]] std::uint64_t n = 1)
+{
+#ifdef CPPDWARF_STATS
+    perf_counters::instance().add(c, n);
+#endif
+}
+
+// Calls a libdwarf function and counts the call, e.g. call<libdwarf_call::child>(dwarf_child, die, &child, err)
+template <libdwarf_call Call, typename F, typename... Args>
+int call(F function, Args &&...args)
+{
+#ifdef CPPDWARF_STATS
+    auto &counters = perf_counters::instance();
+    counters.add_call(Call);
+    if constexpr (is_timed(Call)) {
+        const auto start = std::chrono::steady_clock::now();
+        const int res = function(std::forward<Args>(args)...);
+        counters.add_time(Call, std::chrono::steady_clock::now() - start);
+        return res;
+    }
+#endif
+    return function(std::forward<Args>(args)...);
+}
+
+inline perf_stats perf_snapshot()
+{
+#ifdef CPPDWARF_STATS
+    return perf_counters::instance().snapshot();
+#else
+    return {};
+#endif
+}
+
+inline void perf_reset()
+{
+#ifdef CPPDWARF_STATS
+    perf_counters::instance().reset();
+#endif
+}
+
+} // namespace details
+} // namespace cppdwarf
@@ -0,0 +1,307 @@
+#pragma once
+
+#include <dwarf.h>
+#include <libdwarf.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <cppdwarf/details/error.hpp>
+#include <cppdwarf/details/exceptions.hpp>
+#include <cppdwarf/details/object.hpp>
+#include <cppdwarf/details/stats.hpp>
+
+namespace cppdwarf {
+
+// What the header of a unit in .debug_info says about it
+struct unit_header {
+    std::size_t index = 0;      // position in the unit_table
+    std::size_t offset = 0;     // of the unit header in .debug_info
+    std::size_t length = 0;     // of the whole unit, header included
+    std::size_t die_offset = 0; // of the unit DIE
+    int version = 0;
+    int unit_type = DW_UT_compile; // DW_UT_*, DWARF 2 to 4 units in .debug_info are all reported as DW_UT_compile
+    std::size_t abbrev_offset = 0;
+    int address_size = 0;
+    int offset_size = 4;                // 8 for 64-bit DWARF
+    std::size_t die_count_estimate = 0; // from the unit's size, for progress reporting and balancing work
+
+    [[nodiscard]] std::size_t end() const
+    {
+        return offset + length;
+    }
+};
+
+// The headers of all units in .debug_info, read once in a single pass over the unit headers alone: no DIE is read.
+// Built by debug::units(), it allows jumping to the k-th unit, finding the unit of a DIE offset and splitting the
+// units into parts of about the same size, e.g. for parallel workers:
+//     const auto &units = debug.units();
+//     for (std::size_t i = begin; i < end; ++i) {
+//         auto cu = debug.unit(i);
+//         ...
+//     }
+class unit_table {
+public:
+    using const_iterator = std::vector<unit_header>::const_iterator;
+
+    // the average number of .debug_info bytes per DIE die_count_estimate assumes, typical for C and C++ code
+    static constexpr std::size_t bytes_per_die = 12;
+
+    // Reads the headers from the preloaded .debug_info of `object` if there is one, otherwise from the file if the
+    // section is not compressed. Only for compressed sections libdwarf is asked to walk the units instead.
+    unit_table(Dwarf_Debug dbg, const std::string &path, const elf_object *object)
+    {
+        if (object) {
+            if (const auto *info = object->section_data(".debug_info")) {
+                scan(info->size(), object->big_endian(), [info](std::uint64_t offset, std::size_t size) {
+                    return std::vector<std::uint8_t>(info->begin() + static_cast<std::ptrdiff_t>(offset),
+                                                     info->begin() + static_cast<std::ptrdiff_t>(offset + size));
+                });
+            }
+            return;
+        }
+        if (!scan_file(dbg, path)) {
+            scan_libdwarf(dbg);
+        }
+    }
+
+    [[nodiscard]] std::size_t size() const
+    {
+        return headers_.size();
+    }
+
+    [[nodiscard]] bool empty() const
+    {
+        return headers_.empty();
+    }
+
+    // the bytes of .debug_info the units cover, headers included
+    [[nodiscard]] std::size_t bytes() const
+    {
+        return headers_.empty() ? 0 : headers_.back().end() - headers_.front().offset;
+    }
+
+    // the memory the table holds
+    [[nodiscard]] std::size_t memory() const
+    {
+        return headers_.capacity() * sizeof(unit_header);
+    }
+
+    [[nodiscard]] const unit_header &operator[](std::size_t index) const
+    {
+        return headers_[index];
+    }
+
+    [[nodiscard]] const unit_header &at(std::size_t index) const
+    {
+        if (index >= headers_.size()) {
+            throw out_of_range("unit index " + std::to_string(index) + " out of range");
+        }
+        return headers_[index];
+    }
+
+    [[nodiscard]] const_iterator begin() const
+    {
+        return headers_.begin();
+    }
+
+    [[nodiscard]] const_iterator end() const
+    {
+        return headers_.end();
+    }
+
+    // the unit containing a .debug_info offset, e.g. of a DIE, nullptr if there is none
+    [[nodiscard]] const unit_header *find_by_offset(std::size_t offset) const
+    {
+        auto it = std::upper_bound(headers_.begin(), headers_.end(), offset,
+                                   [](std::size_t value, const unit_header &h) { return value < h.offset; });
+        if (it == headers_.begin() || offset >= (it - 1)->end()) {
+            return nullptr;
+        }
+        return &*(it - 1);
+    }
+
+    // Splits the units into `parts` ranges of consecutive units with about the same number of bytes each. Returns
+    // parts + 1 unit indices, part i covers the units [bounds[i], bounds[i + 1]).
+    [[nodiscard]] std::vector<std::size_t> partition(std::size_t parts) const
+    {
+        parts = std::max<std::size_t>(parts, 1);
+        const auto total = bytes();
+        std::vector<std::size_t> bounds{0};
+        std::size_t bytes = 0;
+        for (std::size_t i = 0; i < headers_.size() && bounds.size() < parts; ++i) {
+            bytes += headers_[i].length;
+            // close the part once it holds its share of the bytes
+            if (bytes * parts >= total * bounds.size()) {
+                bounds.push_back(i + 1);
+            }
+        }
+        while (bounds.size() <= parts) {
+            bounds.push_back(headers_.size());
+        }
+        return bounds;
+    }
+
+private:
+    using read_function = std::function<std::vector<std::uint8_t>(std::uint64_t offset, std::size_t size)>;
+
+    static std::uint64_t read_uint(const std::uint8_t *p, std::size_t size, bool big_endian)
+    {
+        std::uint64_t value = 0;
+        for (std::size_t i = 0; i < size; ++i) {
+            value = (value << 8) | (big_endian ? p[i] : p[size - 1 - i]);
+        }
+        return value;
+    }
+
+    void scan(std::uint64_t section_size, bool big_endian, const read_function &read)
+    {
+        // the longest header: 64-bit DWARF 5 type unit, 12 + 2 + 1 + 1 + 8 + 8 + 8
+        constexpr std::size_t max_header_size = 40;
+        std::uint64_t offset = 0;
+        while (offset < section_size) {
+            const auto available = std::min<std::uint64_t>(max_header_size, section_size - offset);
+            const auto bytes = read(offset, static_cast<std::size_t>(available));
+            std::size_t pos = 0;
+            auto take = [&](std::size_t size) {
+                if (pos + size > bytes.size()) {
+                    throw init_error("truncated unit header at .debug_info offset " + std::to_string(offset));
+                }
+                const auto value = read_uint(&bytes[pos], size, big_endian);
+                pos += size;
+                return value;
+            };
+
+            unit_header h;
+            h.index = headers_.size();
+            h.offset = static_cast<std::size_t>(offset);
+            std::uint64_t length = take(4);
+            if (length == 0xffffffff) {
+                length = take(8);
+                h.offset_size = 8;
+            }
+            else if (length >= 0xfffffff0) {
+                throw init_error("reserved unit length in .debug_info");
+            }
+            if (length > section_size - offset - pos) {
+                throw init_error("unit at .debug_info offset " + std::to_string(offset) + " overruns the section");
+            }
+            h.length = static_cast<std::size_t>(pos + length);
+            h.version = static_cast<int>(take(2));
+            if (h.version >= 5) {
+                h.unit_type = static_cast<int>(take(1));
+                h.address_size = static_cast<int>(take(1));
+                h.abbrev_offset = static_cast<std::size_t>(take(h.offset_size));
+                switch (h.unit_type) {
+                case DW_UT_skeleton:
+                case DW_UT_split_compile:
+                    pos += 8; // dwo_id
+                    break;
+                case DW_UT_type:
+                case DW_UT_split_type:
+                    pos += 8 + h.offset_size; // type_signature, type_offset
+                    break;
+                default:
+                    break;
+                }
+            }
+            else {
+                h.abbrev_offset = static_cast<std::size_t>(take(h.offset_size));
+                h.address_size = static_cast<int>(take(1));
+            }
+            h.die_offset = h.offset + pos;
+            h.die_count_estimate = (h.length - std::min(h.length, pos)) / bytes_per_die + 1;
+            headers_.push_back(h);
+            offset += h.length;
+        }
+    }
+
+    // reads the unit headers straight from the file, returns false if they have to be read through libdwarf instead
+    bool scan_file(Dwarf_Debug dbg, const std::string &path)
+    {
+        Dwarf_Addr addr = 0;
+        Dwarf_Unsigned size = 0;
+        Dwarf_Unsigned flags = 0;
+        Dwarf_Unsigned file_offset = 0;
+        dwarf_error error(dbg);
+        int res = dwarf_get_section_info_by_name_a(dbg, ".debug_info", &addr, &size, &flags, &file_offset,
+                                                   error.out());
+        constexpr Dwarf_Unsigned shf_compressed = 0x800;
+        if (res != DW_DLV_OK || (flags & shf_compressed)) {
+            // no .debug_info does not mean no units, they may be in a .zdebug_info this lookup does not find: the
+            // libdwarf scan tells
+            return false;
+        }
+
+        std::ifstream file(path, std::ios::binary);
+        std::uint8_t ident[6] = {};
+        if (!file.read(reinterpret_cast<char *>(ident), sizeof(ident)) || ident[0] != 0x7f || ident[1] != 'E') {
+            return false; // not ELF, the byte order is unknown
+        }
+        scan(size, ident[5] == 2, [&](std::uint64_t offset, std::size_t n) {
+            std::vector<std::uint8_t> bytes(n);
+            file.seekg(static_cast<std::streamoff>(file_offset + offset));
+            if (!file.read(reinterpret_cast<char *>(bytes.data()), static_cast<std::streamsize>(n))) {
+                throw init_error("failed to read .debug_info from " + path);
+            }
+            return bytes;
+        });
+        return true;
+    }
+
+    // Walks the units with dwarf_next_cu_header_e(), which keeps its position in the Dwarf_Debug: this must not
+    // happen while the compilation units are being iterated. It runs to the end, so the next iteration starts over.
+    void scan_libdwarf(Dwarf_Debug dbg)
+    {
+        headers_.clear();
+        Dwarf_Unsigned offset = 0;
+        while (true) {
+            Dwarf_Die cu_die = nullptr;
+            Dwarf_Unsigned length = 0;
+            Dwarf_Unsigned abbrev_offset = 0;
+            Dwarf_Half version = 0, address_size = 0, offset_size = 0, extension_size = 0;
+            Dwarf_Sig8 signature;
+            Dwarf_Unsigned type_offset = 0;
+            Dwarf_Unsigned next_offset = 0;
+            Dwarf_Half unit_type = 0;
+            dwarf_error error(dbg);
+            int res = details::call<libdwarf_call::next_cu_header_e>(
+                dwarf_next_cu_header_e, dbg, true, &cu_die, &length, &version, &abbrev_offset, &address_size,
+                &offset_size, &extension_size, &signature, &type_offset, &next_offset, &unit_type, error.out());
+            if (res == DW_DLV_NO_ENTRY) {
+                return;
+            }
+            if (res != DW_DLV_OK) {
+                throw init_error("dwarf_next_cu_header_e failed!");
+            }
+            Dwarf_Off die_offset = 0;
+            res = details::call<libdwarf_call::dieoffset>(dwarf_dieoffset, cu_die, &die_offset, error.out());
+            dwarf_dealloc_die(cu_die);
+            if (res != DW_DLV_OK) {
+                throw init_error("dwarf_dieoffset failed!");
+            }
+
+            unit_header h;
+            h.index = headers_.size();
+            h.offset = static_cast<std::size_t>(offset);
+            h.length = static_cast<std::size_t>(next_offset - offset);
+            h.die_offset = static_cast<std::size_t>(die_offset);
+            h.version = version;
+            h.unit_type = unit_type;
+            h.abbrev_offset = static_cast<std::size_t>(abbrev_offset);
+            h.address_size = address_size;
+            h.offset_size = offset_size;
+            h.die_count_estimate = (h.end() - h.die_offset) / bytes_per_die + 1;
+            headers_.push_back(h);
+            offset = next_offset;
+        }
+    }
+
+    std::vector<unit_header> headers_;
+};
+
+} // namespace cppdwarf
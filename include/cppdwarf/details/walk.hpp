@@ -0,0 +1,155 @@
+#pragma once
+
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <cppdwarf/details/compilation_unit.hpp>
+#include <cppdwarf/details/die.hpp>
+#include <cppdwarf/details/progress.hpp>
+
+namespace cppdwarf {
+
+enum class walk_result {
+    continue_, // descend into the children of this DIE
+    skip,      // do not descend, continue with the next sibling
+    stop,      // end the walk
+};
+
+struct walk_context {
+    std::size_t depth;         // 0 for the children of the root
+    std::size_t parent_offset; // offset of the parent DIE
+};
+
+// Depth-first traversal that keeps its stack in a vector instead of recursing, so deeply nested DIE trees cannot
+// overflow the call stack. A walker can be reused for many units to keep the stack's allocation around.
+//
+// The visitor is called with enter(const die &, const walk_context &) for every DIE below the root, returning a
+// walk_result (or void to always descend). If it also has leave(const die &, const walk_context &), that is called
+// once the DIE's subtree is done, including when it was skipped, but not after a stop.
+//
+// `Die` is the DIE type to walk, cppdwarf::die or native::die.
+template <typename Die>
+class basic_walker {
+public:
+    basic_walker() = default;
+
+    // only the children with one of the given tags are visited, the other ones are skipped unmaterialized
+    explicit basic_walker(tag_set tags) : tags_(std::move(tags)) {}
+
+    basic_walker(const basic_walker &) = delete;
+    basic_walker &operator=(const basic_walker &) = delete;
+
+    basic_walker(basic_walker &&other) = default;
+    basic_walker &operator=(basic_walker &&other) = default;
+
+    // Reports the DIEs visited to `monitor` every scan_monitor::die_interval DIEs and stops the walk there once its
+    // token is cancelled, as if the visitor had returned walk_result::stop. nullptr detaches the monitor.
+    void set_monitor(scan_monitor *monitor)
+    {
+        monitor_ = monitor;
+    }
+
+    // returns false if the visitor stopped the walk, or it was cancelled
+    template <typename Visitor>
+    bool walk(const Die &root, Visitor &&visitor)
+    {
+        stack_.clear();
+        push(root);
+        std::size_t unreported = 0;
+        while (!stack_.empty()) {
+            auto &top = stack_.back();
+            if (top.it == top.end) {
+                stack_.pop_back();
+                if (!stack_.empty()) {
+                    leave(visitor);
+                }
+                continue;
+            }
+
+            if (monitor_ && ++unreported == scan_monitor::die_interval) {
+                unreported = 0;
+                if (!monitor_->dies_visited(scan_monitor::die_interval)) {
+                    stack_.clear();
+                    return false;
+                }
+            }
+            const Die &current = *top.it;
+            const walk_context context{stack_.size() - 1, top.parent_offset};
+            walk_result result = walk_result::continue_;
+            if constexpr (std::is_void_v<decltype(visitor.enter(current, context))>) {
+                visitor.enter(current, context);
+            }
+            else {
+                result = visitor.enter(current, context);
+            }
+
+            if (result == walk_result::stop) {
+                stack_.clear();
+                return false;
+            }
+            if (result == walk_result::skip) {
+                leave(visitor);
+                continue;
+            }
+            push(current);
+        }
+        if (monitor_) {
+            monitor_->dies_visited(unreported);
+        }
+        return true;
+    }
+
+    template <typename Visitor>
+    bool walk(const compilation_unit &cu, Visitor &&visitor)
+    {
+        return walk(cu.die(), std::forward<Visitor>(visitor));
+    }
+
+private:
+    struct frame {
+        std::size_t parent_offset;
+        typename Die::const_iterator it;
+        typename Die::const_iterator end;
+    };
+
+    template <typename Visitor, typename = void>
+    struct has_leave : std::false_type {};
+
+    template <typename Visitor>
+    struct has_leave<Visitor, std::void_t<decltype(std::declval<Visitor &>().leave(
+                                  std::declval<const Die &>(), std::declval<const walk_context &>()))>>
+        : std::true_type {};
+
+    void push(const Die &parent)
+    {
+        stack_.push_back({parent.offset(), tags_ ? parent.begin(*tags_) : parent.begin(), parent.end()});
+    }
+
+    // leaves the current DIE of the top frame and advances to its next sibling
+    template <typename Visitor>
+    void leave(Visitor &visitor)
+    {
+        auto &top = stack_.back();
+        if constexpr (has_leave<std::remove_reference_t<Visitor>>::value) {
+            visitor.leave(*top.it, walk_context{stack_.size() - 1, top.parent_offset});
+        }
+        ++top.it;
+    }
+
+    std::optional<tag_set> tags_;
+    std::vector<frame> stack_;
+    scan_monitor *monitor_ = nullptr;
+};
+
+using walker = basic_walker<die>;
+
+// Walks all DIEs below the unit's root DIE, see walker
+template <typename Visitor>
+bool walk(const compilation_unit &cu, Visitor &&visitor)
+{
+    return walker().walk(cu, std::forward<Visitor>(visitor));
+}
+
+} // namespace cppdwarf
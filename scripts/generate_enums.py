@@ -1,6 +1,59 @@
 import argparse
 import os.path
 
+# DWARF 5 section 7.5.6: class and size in the DIE of every form. A size of -1 means the form is variable-length or
+# its size depends on the unit (address size or offset size).
+FORM_TRAITS = {
+    "addr": ("address", -1),
+    "block2": ("block", -1),
+    "block4": ("block", -1),
+    "data2": ("constant", 2),
+    "data4": ("constant", 4),
+    "data8": ("constant", 8),
+    "string": ("string", -1),
+    "block": ("block", -1),
+    "block1": ("block", -1),
+    "data1": ("constant", 1),
+    "flag": ("flag", 1),
+    "sdata": ("constant", -1),
+    "strp": ("string", -1),
+    "udata": ("constant", -1),
+    "ref_addr": ("reference", -1),
+    "ref1": ("reference", 1),
+    "ref2": ("reference", 2),
+    "ref4": ("reference", 4),
+    "ref8": ("reference", 8),
+    "ref_udata": ("reference", -1),
+    "indirect": ("indirect", -1),
+    "sec_offset": ("section_offset", -1),
+    "exprloc": ("exprloc", -1),
+    "flag_present": ("flag", 0),
+    "strx": ("string", -1),
+    "addrx": ("address", -1),
+    "ref_sup4": ("reference", 4),
+    "strp_sup": ("string", -1),
+    "data16": ("constant", 16),
+    "line_strp": ("string", -1),
+    "ref_sig8": ("reference", 8),
+    "implicit_const": ("constant", 0),
+    "loclistx": ("section_offset", -1),
+    "rnglistx": ("section_offset", -1),
+    "ref_sup8": ("reference", 8),
+    "strx1": ("string", 1),
+    "strx2": ("string", 2),
+    "strx3": ("string", 3),
+    "strx4": ("string", 4),
+    "addrx1": ("address", 1),
+    "addrx2": ("address", 2),
+    "addrx3": ("address", 3),
+    "addrx4": ("address", 4),
+    "GNU_addr_index": ("address", -1),
+    "GNU_str_index": ("string", -1),
+    "GNU_ref_alt": ("reference", -1),
+    "GNU_strp_alt": ("string", -1),
+    "LLVM_addrx_offset": ("address", -1),
+}
+
 
 def generate_file(data, class_name, output_path):
     with open(output_path, "w", encoding='utf-8') as f:
@@ -13,6 +66,24 @@ def generate_file(data, class_name, output_path):
         for name, value, raw_name in data:
             f.write(f"{name} = {raw_name},\n")
         f.write("};\n\n")
+
+        # dwarf.h defines aliases sharing a value, the table keeps the first name like dwarf_get_*_name() does
+        if class_name == "form":
+            f.write("namespace details {\n")
+            f.write("inline constexpr auto form_table = sort_by_value<form_entry>({\n")
+            for name, value, raw_name in data:
+                form_class, size = FORM_TRAITS.get(name, ("unknown", -1))
+                f.write(f"{{{class_name}::{name}, \"{raw_name}\", form_class::{form_class}, {size}}},\n")
+            f.write("});\n")
+            f.write("} // namespace details\n\n")
+        else:
+            f.write("namespace details {\n")
+            f.write(f"inline constexpr auto {class_name}_names = sort_by_value<enum_entry<{class_name}>>({{\n")
+            for name, value, raw_name in data:
+                f.write(f"{{{class_name}::{name}, \"{raw_name}\"}},\n")
+            f.write("});\n")
+            f.write("} // namespace details\n\n")
+
         f.write("}\n")
 
 
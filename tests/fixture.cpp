@@ -0,0 +1,79 @@
+// A program with a bit of everything the DIE readers have to get through: namespaces, nested and templated types,
+// enums, inline namespaces, lambdas and standard library containers.
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace fixture {
+
+enum class color : std::uint8_t {
+    red,
+    green = 200,
+};
+
+template <typename T, std::uint64_t N>
+struct buffer {
+    T items[N];
+    std::size_t size = 0;
+};
+
+inline namespace v1 {
+
+struct shape {
+    virtual ~shape() = default;
+    [[nodiscard]] virtual double area() const = 0;
+
+    struct bounds {
+        double x, y, width, height;
+    };
+    bounds box{};
+};
+
+} // namespace v1
+
+class circle : public shape {
+public:
+    explicit circle(double r) : r_(r) {}
+
+    [[nodiscard]] double area() const override
+    {
+        return 3.14159 * r_ * r_;
+    }
+
+private:
+    double r_;
+};
+
+union number {
+    std::int64_t i;
+    double d;
+};
+
+std::map<std::string, std::vector<int>> index(const std::vector<std::string> &words)
+{
+    std::map<std::string, std::vector<int>> result;
+    for (std::size_t i = 0; i < words.size(); ++i) {
+        result[words[i]].push_back(static_cast<int>(i));
+    }
+    return result;
+}
+
+} // namespace fixture
+
+int main(int argc, char *argv[])
+{
+    fixture::buffer<fixture::color, 16> colors{};
+    colors.items[colors.size++] = fixture::color::green;
+
+    std::vector<std::unique_ptr<fixture::shape>> shapes;
+    shapes.push_back(std::make_unique<fixture::circle>(argc));
+    fixture::number n{};
+    n.d = shapes.front()->area();
+
+    auto words = std::vector<std::string>(argv, argv + argc);
+    auto count = [&](const std::string &word) { return fixture::index(words)[word].size(); };
+    return static_cast<int>(count(words.front()) + static_cast<std::size_t>(n.i & 1)) - 1;
+}
@@ -0,0 +1,175 @@
+// Differential test of the word-at-a-time LEB128 decoders against the byte-at-a-time ones, on random encodings of
+// every length: minimal, padded with redundant continuation bytes, longer than 10 bytes, truncated by the end of the
+// buffer and plain random bytes. Each case is decoded at every offset, so the word-wise path sees values that end
+// right at, and just past, the last 8 bytes of the buffer.
+//
+//     leb128_test [iterations] [seed]
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <cppdwarf/cppdwarf.hpp>
+
+namespace leb128 = cppdwarf::leb128;
+
+namespace {
+
+int failures = 0;
+
+void report(const char *what, const std::vector<std::uint8_t> &bytes, std::size_t offset)
+{
+    if (++failures > 20) {
+        return; // enough to go on
+    }
+    std::cerr << what << " at offset " << offset << " of";
+    for (const auto b : bytes) {
+        std::cerr << " " << std::hex << static_cast<unsigned>(b) << std::dec;
+    }
+    std::cerr << "\n";
+}
+
+// the minimal encoding of `value`, followed by `padding` redundant continuation groups
+void encode_unsigned(std::uint64_t value, std::size_t padding, std::vector<std::uint8_t> &out)
+{
+    do {
+        std::uint8_t byte = value & 0x7f;
+        value >>= 7;
+        if (value != 0 || padding > 0) {
+            byte |= 0x80;
+        }
+        out.push_back(byte);
+    } while (value != 0);
+    for (; padding > 0; --padding) {
+        out.push_back(padding > 1 ? 0x80 : 0x00);
+    }
+}
+
+void encode_signed(std::int64_t value, std::vector<std::uint8_t> &out)
+{
+    while (true) {
+        const std::uint8_t byte = value & 0x7f;
+        value >>= 7; // arithmetic
+        if ((value == 0 && !(byte & 0x40)) || (value == -1 && (byte & 0x40))) {
+            out.push_back(byte);
+            return;
+        }
+        out.push_back(byte | 0x80);
+    }
+}
+
+// a value with a random number of significant bits, so every encoded length is about as likely
+std::uint64_t random_value(std::mt19937_64 &rng)
+{
+    const auto bits = std::uniform_int_distribution<unsigned>(0, 64)(rng);
+    return bits == 0 ? 0 : rng() >> (64 - bits);
+}
+
+void check_buffer(const std::vector<std::uint8_t> &bytes)
+{
+    const auto *end = bytes.data() + bytes.size();
+    for (std::size_t offset = 0; offset < bytes.size(); ++offset) {
+        const auto *pos = bytes.data() + offset;
+        const auto u = leb128::decode_unsigned(pos, end);
+        const auto u_ref = leb128::decode_unsigned_scalar(pos, end);
+        if (u.value != u_ref.value || u.length != u_ref.length) {
+            report("decode_unsigned differs", bytes, offset);
+        }
+        const auto s = leb128::decode_signed(pos, end);
+        const auto s_ref = leb128::decode_signed_scalar(pos, end);
+        if (s.value != s_ref.value || s.length != s_ref.length) {
+            report("decode_signed differs", bytes, offset);
+        }
+        if (leb128::length(pos, end) != u_ref.length) {
+            report("length differs", bytes, offset);
+        }
+    }
+}
+
+// checks that decoding the encodings of known values gives them back
+void check_round_trip(std::mt19937_64 &rng, std::size_t iterations)
+{
+    std::vector<std::uint8_t> bytes;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        bytes.clear();
+        const auto value = random_value(rng);
+        const auto padding = std::uniform_int_distribution<std::size_t>(0, 3)(rng);
+        encode_unsigned(value, padding, bytes);
+        const auto encoded = bytes.size();
+        // trailing bytes, so both the word-wise and the byte-wise paths are taken
+        bytes.resize(encoded + std::uniform_int_distribution<std::size_t>(0, 9)(rng), 0xff);
+        const auto u = leb128::decode_unsigned(bytes.data(), bytes.data() + bytes.size());
+        if ((encoded <= 10 && u.value != value) || u.length != encoded) {
+            report("unsigned round trip failed", bytes, 0);
+        }
+
+        bytes.clear();
+        const auto signed_value = static_cast<std::int64_t>(value) >> std::uniform_int_distribution<int>(0, 63)(rng);
+        encode_signed(signed_value, bytes);
+        const auto signed_encoded = bytes.size();
+        bytes.resize(signed_encoded + std::uniform_int_distribution<std::size_t>(0, 9)(rng), 0x80);
+        const auto s = leb128::decode_signed(bytes.data(), bytes.data() + bytes.size());
+        if (s.value != signed_value || s.length != signed_encoded) {
+            report("signed round trip failed", bytes, 0);
+        }
+    }
+}
+
+// random streams of values, truncated at random, and random bytes with a varying density of continuation bits
+void check_streams(std::mt19937_64 &rng, std::size_t iterations)
+{
+    std::vector<std::uint8_t> bytes;
+    for (std::size_t i = 0; i < iterations; ++i) {
+        bytes.clear();
+        if (i % 2 == 0) {
+            const auto values = std::uniform_int_distribution<int>(1, 4)(rng);
+            for (int v = 0; v < values; ++v) {
+                const auto padding = std::uniform_int_distribution<std::size_t>(0, 8)(rng);
+                encode_unsigned(random_value(rng), padding, bytes);
+            }
+            bytes.resize(std::uniform_int_distribution<std::size_t>(1, bytes.size())(rng));
+        }
+        else {
+            const auto continuation = std::uniform_int_distribution<int>(0, 100)(rng);
+            const auto size = std::uniform_int_distribution<std::size_t>(1, 24)(rng);
+            for (std::size_t b = 0; b < size; ++b) {
+                auto byte = static_cast<std::uint8_t>(rng() & 0x7f);
+                if (std::uniform_int_distribution<int>(0, 99)(rng) < continuation) {
+                    byte |= 0x80;
+                }
+                bytes.push_back(byte);
+            }
+        }
+        check_buffer(bytes);
+    }
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    const auto iterations = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 200000;
+    const auto seed = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 1;
+    std::mt19937_64 rng(seed);
+
+    check_round_trip(rng, iterations);
+    check_streams(rng, iterations);
+#ifdef CPPDWARF_LEB128_BMI2
+    // both ways of packing the groups, whichever decode_unsigned picked on this CPU
+    if (__builtin_cpu_supports("bmi2")) {
+        for (std::size_t i = 0; i < iterations; ++i) {
+            const auto groups = rng() & 0x7f7f7f7f7f7f7f7fULL;
+            if (leb128::pack_groups(groups) != leb128::pack_groups_bmi2(groups)) {
+                ++failures;
+                std::cerr << "pack_groups and pack_groups_bmi2 differ for " << std::hex << groups << std::dec << "\n";
+                break;
+            }
+        }
+    }
+#endif
+
+    std::cout << iterations << " iterations with seed " << seed << ", " << failures << " failures\n";
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,143 @@
+// Checks that the native reader decodes the same DIE trees as libdwarf: every DIE at the same offset, with the same
+// tag, name and declaration line, in the same order.
+//
+//     native_test <binary>...
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <cppdwarf/cppdwarf.hpp>
+
+namespace dw = cppdwarf;
+
+namespace {
+
+struct die_record {
+    std::size_t offset;
+    dw::tag tag;
+    std::string name;
+    std::int64_t line;
+    std::size_t depth;
+
+    bool operator==(const die_record &other) const
+    {
+        return offset == other.offset && tag == other.tag && name == other.name && line == other.line &&
+               depth == other.depth;
+    }
+};
+
+std::ostream &operator<<(std::ostream &os, const die_record &record)
+{
+    return os << "0x" << std::hex << record.offset << std::dec << " " << dw::to_string(record.tag) << " '"
+              << record.name << "' line " << record.line << " depth " << record.depth;
+}
+
+template <typename Die>
+die_record record_of(const Die &die, std::size_t depth)
+{
+    auto [name, line] = die.template read<dw::attribute_t::name, dw::attribute_t::decl_line>();
+    return {die.offset(), die.tag(), name.value_or(""), line ? static_cast<std::int64_t>(*line) : -1, depth};
+}
+
+// the root DIE and everything below it, in walk order
+template <typename Walker, typename Die>
+std::vector<die_record> records_of(Walker &walker, const Die &root)
+{
+    std::vector<die_record> records{record_of(root, 0)};
+    struct visitor {
+        std::vector<die_record> &records;
+
+        void enter(const Die &die, const dw::walk_context &context)
+        {
+            records.push_back(record_of(die, context.depth + 1));
+        }
+    };
+    walker.walk(root, visitor{records});
+    return records;
+}
+
+// returns the number of mismatches
+int compare(const std::string &path)
+{
+    dw::debug debug(path);
+    const dw::native::reader reader(debug);
+    dw::walker walker;
+    dw::native::walker native_walker;
+
+    int failures = 0;
+    auto fail = [&](const std::string &what) {
+        std::cerr << path << ": " << what << "\n";
+        ++failures;
+    };
+
+    std::size_t units = 0;
+    std::size_t dies = 0;
+    for (const auto &cu : debug) {
+        const auto &cu_die = cu.die();
+        const auto &unit = reader.unit_at(cu_die.offset());
+        if (unit.version() != cu.version()) {
+            fail("DWARF version " + std::to_string(unit.version()) + " instead of " + std::to_string(cu.version()));
+        }
+
+        const auto expected = records_of(walker, cu_die);
+        const auto actual = records_of(native_walker, unit.die());
+        for (std::size_t i = 0; i < std::max(expected.size(), actual.size()); ++i) {
+            if (i >= actual.size() || i >= expected.size() || !(expected[i] == actual[i])) {
+                std::cerr << path << ": DIE " << i << " differs\n  libdwarf: ";
+                if (i < expected.size()) {
+                    std::cerr << expected[i];
+                }
+                std::cerr << "\n  native:   ";
+                if (i < actual.size()) {
+                    std::cerr << actual[i];
+                }
+                std::cerr << "\n";
+                ++failures;
+                break; // the rest of the unit is out of step
+            }
+        }
+
+        // attribute_list::at() reads like its libdwarf counterpart
+        const auto name = cu_die.attributes().at(dw::attribute_t::name)->get<std::string>();
+        const auto native_name = unit.die().attributes().at(dw::attribute_t::name)->get<std::string>();
+        if (name != native_name) {
+            fail("unit name '" + native_name + "' instead of '" + name + "'");
+        }
+        if (unit.src_files() != cu_die.src_files()) {
+            fail("the line table files of " + name + " differ");
+        }
+
+        ++units;
+        dies += expected.size();
+    }
+    if (units == 0) {
+        fail("no compilation units");
+    }
+    std::cout << path << ": " << units << " units, " << dies << " DIEs compared, " << failures << " mismatches\n";
+    return failures;
+}
+
+} // namespace
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2) {
+        std::cerr << "usage: " << argv[0] << " <binary>...\n";
+        return 2;
+    }
+    int failures = 0;
+    for (int i = 1; i < argc; ++i) {
+        try {
+            failures += compare(argv[i]);
+        }
+        catch (const std::exception &err) {
+            std::cerr << argv[i] << ": " << err.what() << "\n";
+            ++failures;
+        }
+    }
+    return failures == 0 ? 0 : 1;
+}